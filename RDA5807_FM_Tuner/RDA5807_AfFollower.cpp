@@ -0,0 +1,222 @@
+/*
+ Name:		RDA5807_AfFollower.cpp
+ Created:	18/10/2026 10:14:22 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "RDA5807_AfFollower.h"
+
+void RDA5807_AfFollower::begin(const uint16_t& freq)
+{
+	m_tunedFrequency = freq;
+	m_weakCount = 0;
+	m_lastSample = millis();
+	m_lastAttempt = millis() - m_settings.retryInterval;//allow first attempt without waiting
+	m_state = state::monitoring;
+}
+
+void RDA5807_AfFollower::end(void)
+{
+	if (m_state == state::measuringCandidates || m_state == state::verifyingPi || m_state == state::returning)
+	{
+		m_receiver.startFrequencyChange(m_tunedFrequency);
+		endDropout();
+	}
+	m_state = state::disabled;
+}
+
+bool RDA5807_AfFollower::update(void)
+{
+	switch (m_state)
+	{
+	case state::monitoring:
+		updateMonitoring();
+		return false;
+
+	case state::measuringCandidates:
+		updateCandidateMeasurement();
+		return false;
+
+	case state::verifyingPi:
+		return updatePiVerification();
+
+	case state::returning:
+		updateReturning();
+		return false;
+
+	default:
+		return false;
+	}
+}
+
+void RDA5807_AfFollower::updateMonitoring(void)
+{
+	const RdsDecoder* const rds = m_receiver.getDecodedRdsData();
+	bool weak = false;
+
+	if (!sampleSignal(weak)) return;
+	if (weak)
+	{
+		if (m_weakCount < 0xFF) m_weakCount++;
+	}
+	else m_weakCount = 0;
+
+	if (m_weakCount < ((m_monitor != nullptr) ? 1 : m_settings.weakSamples)) return;//monitor already averages samples
+	if ((millis() - m_lastAttempt) < m_settings.retryInterval) return;
+	if (rds == nullptr || !rds->getAlternativeFrequencyCount()) return;//nothing to check
+
+	m_lastAttempt = millis();
+	m_stats.attempts++;
+	m_tunedRssi = (m_monitor != nullptr) ? static_cast<uint8_t>(m_monitor->getRssiAverage()) : m_receiver.getRssi();
+	m_expectedPi = rds->getAlternativeFrequencyListPi();
+	m_wasMuted = m_receiver.getMute();
+	m_dropoutStart = micros();
+	m_receiver.setRdsDecodingHold();//groups from candidates would replace AF list and other data of received station
+	m_receiver.updateMute(true);
+	memset(m_candidateRssi, 0, sizeof(m_candidateRssi));
+	for (m_candidateCount = 0; m_candidateCount < rds->getAlternativeFrequencyCount() && m_candidateCount < RDS_AF_LIST_SIZE; m_candidateCount++)
+		m_candidates[m_candidateCount] = rds->getAlternativeFrequency(m_candidateCount);
+	m_candidateIndex = 0xFF;//incremented to 0 by startNextCandidate()
+	if (loadCandidatesFromDatabase())
+	{//signal levels are already known, go straight to PI verification
+		m_stats.databaseHits++;
+		m_candidateIndex = m_candidateCount - 1;
+	}
+	startNextCandidate();
+}
+
+bool RDA5807_AfFollower::sampleSignal(bool& weak)
+{
+	if (m_monitor != nullptr)
+	{
+		if (!m_monitor->update()) return false;
+		weak = m_monitor->getWeakSignal() || m_monitor->getHighBlockErrorRate();
+		return true;
+	}
+
+	if ((millis() - m_lastSample) < m_settings.sampleInterval) return false;
+	m_lastSample = millis();
+	if (!m_receiver.updateStatusRegisters()) return false;
+
+	weak = m_receiver.getRssi() < m_settings.weakRssi ||
+		(m_receiver.getRdsSynchronizationState() && m_receiver.getBlockErrorsLevelOfRdsData1() == RDA5807::blockErrorLevel::bel6AndMoreErrors);//block B errors mean that RDS, and usually audio, is already distorted
+	return true;
+}
+
+void RDA5807_AfFollower::updateCandidateMeasurement(void)
+{
+	if ((millis() - m_stateStart) < m_settings.settleTime) return;
+	if (!m_receiver.checkIfTuneIsComplete())
+	{
+		if ((millis() - m_stateStart) > (m_settings.settleTime + m_settings.piTimeout)) startNextCandidate();//receiver can't tune to this frequency
+		return;
+	}
+
+	m_stats.checkedCandidates++;
+	m_candidateRssi[m_candidateIndex] = m_receiver.getRssi();
+	startNextCandidate();
+}
+
+bool RDA5807_AfFollower::updatePiVerification(void)
+{
+	if ((millis() - m_stateStart) > (m_settings.settleTime + m_settings.piTimeout))
+	{
+		m_stats.failedPiChecks++;
+		startNextCandidate();//continues with next strongest candidate
+		return false;
+	}
+	if ((millis() - m_stateStart) < m_settings.settleTime) return false;
+	if (!m_receiver.checkIfNewRdsDataIsReady() || !m_receiver.updateRdsData()) return false;
+
+	if (m_receiver.getRdsData0() != m_expectedPi)
+	{//other programme is broadcasted on this frequency
+		m_stats.failedPiChecks++;
+		startNextCandidate();
+		return false;
+	}
+	if (++m_piMatches < RDS_PI_CONFIRMATIONS) return false;//first group can be a stale one, received before frequency change
+
+	m_tunedFrequency = m_candidateFrequency;
+	m_weakCount = 0;
+	if (m_monitor != nullptr) m_monitor->reset();//statistics of previous frequency are useless now
+	m_stats.switches++;
+	endDropout();
+	m_stats.lastSwitchDropoutTime = m_stats.lastDropoutTime;
+	m_state = state::monitoring;
+	return true;
+}
+
+void RDA5807_AfFollower::updateReturning(void)
+{
+	if ((millis() - m_stateStart) < m_settings.settleTime) return;
+	if (!m_receiver.checkIfTuneIsComplete() && ((millis() - m_stateStart) <= (m_settings.settleTime + m_settings.piTimeout))) return;
+
+	m_weakCount = 0;
+	endDropout();
+	m_state = state::monitoring;
+}
+
+bool RDA5807_AfFollower::loadCandidatesFromDatabase(void)
+{
+	RDA5807_StationDatabase::station known;
+	bool found = false;
+
+	if (m_database == nullptr || !m_database->findStation(m_expectedPi, known)) return false;
+	if (RDA5807_StationDatabase::getStationAge(known) > m_databaseMaxAge) return false;//data is too old to rely on
+
+	for (uint8_t i = 0; i < m_candidateCount; i++)
+	{
+		m_candidateRssi[i] = RDA5807_StationDatabase::getFrequencyRssi(known, m_candidates[i]);
+		if (m_candidateRssi[i]) found = true;
+	}
+	return found;
+}
+
+void RDA5807_AfFollower::startNextCandidate(void)
+{
+	uint16_t channel = 0;
+
+	m_stateStart = millis();
+	while (++m_candidateIndex < m_candidateCount)
+	{
+		m_candidateFrequency = m_candidates[m_candidateIndex];
+		if (m_candidateFrequency == m_tunedFrequency) continue;
+		if (!m_receiver.convertFrequencyToChannel(m_candidateFrequency, channel)) continue;//outside of selected band
+		if (!m_receiver.startFrequencyChange(m_candidateFrequency)) continue;
+
+		m_state = state::measuringCandidates;
+		return;
+	}
+
+	if (startStrongestCandidate()) return;//all candidates measured, check if the strongest one broadcasts the same programme
+
+	m_receiver.startFrequencyChange(m_tunedFrequency);//no better frequency found, go back
+	m_state = state::returning;
+}
+
+bool RDA5807_AfFollower::startStrongestCandidate(void)
+{
+	uint8_t best = 0xFF;
+
+	for (uint8_t i = 0; i < m_candidateCount; i++)
+		if (m_candidateRssi[i] >= (m_tunedRssi + m_settings.hysteresis) && (best == 0xFF || m_candidateRssi[i] > m_candidateRssi[best])) best = i;
+	if (best == 0xFF) return false;
+
+	m_candidateRssi[best] = 0;//don't try it again if PI is different
+	m_candidateFrequency = m_candidates[best];
+	if (!m_receiver.startFrequencyChange(m_candidateFrequency)) return false;
+	m_piMatches = 0;
+	m_stateStart = millis();
+	m_state = state::verifyingPi;
+	return true;
+}
+
+void RDA5807_AfFollower::endDropout(void)
+{
+	m_receiver.setRdsDecodingHold(false);
+	m_receiver.updateMute(m_wasMuted);
+	m_stats.lastDropoutTime = micros() - m_dropoutStart;
+	if (m_stats.lastDropoutTime > m_stats.maxDropoutTime) m_stats.maxDropoutTime = m_stats.lastDropoutTime;
+}
@@ -0,0 +1,238 @@
+/*
+ Name:		RDA5807_AfFollower.h
+ Created:	18/10/2026 10:14:22 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _RDA5807_AFFOLLOWER_h
+#define _RDA5807_AFFOLLOWER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "RDA5807_FM_Tuner.h"
+#include "RDA5807_StationDatabase.h"
+#include "RDA5807_SignalMonitor.h"
+
+class RDA5807_AfFollower final
+{
+public:
+	/// <summary>
+	/// Possible states of AF following.
+	/// </summary>
+	enum class state : uint8_t { disabled, monitoring, measuringCandidates, verifyingPi, returning };
+
+	/// <summary>
+	/// Statistics of AF following.
+	/// </summary>
+	struct afFollowerStats
+	{
+		uint16_t switches;//number of switches to alternative frequency
+		uint16_t attempts;//number of times when signal was too weak and alternative frequencies were checked
+		uint16_t checkedCandidates;//number of alternative frequencies on which signal was measured
+		uint16_t failedPiChecks;//number of the strongest alternative frequencies rejected because of other or missing PI
+		uint16_t databaseHits;//number of attempts in which signal levels were taken from station database instead of being measured
+		uint32_t lastDropoutTime;//time in us during which audio was muted in last attempt
+		uint32_t maxDropoutTime;//max time in us during which audio was muted
+		uint32_t lastSwitchDropoutTime;//time in us during which audio was muted in last attempt which ended with switch
+	};
+
+private:
+	RDA5807& m_receiver;
+	const RDA5807_StationDatabase* m_database = nullptr;
+	RDA5807_SignalMonitor* m_monitor = nullptr;
+	unsigned long m_databaseMaxAge = 0;
+	state m_state = state::disabled;
+
+	/// <summary>
+	/// Settings of AF following.
+	/// </summary>
+	struct
+	{
+		uint8_t weakRssi = 20;//RSSI below which signal is treated as weak
+		uint8_t hysteresis = 6;//how much RSSI of alternative frequency has to be higher than RSSI of tuned one
+		uint8_t weakSamples = 3;//number of consecutive weak samples which start checking of alternative frequencies
+		uint16_t sampleInterval = 200;//time in ms between signal samples
+		uint16_t settleTime = 10;//time in ms to wait after frequency change before signal is measured
+		uint16_t piTimeout = 300;//max time in ms to wait for PI on alternative frequency
+		uint16_t retryInterval = 10000;//min time in ms between checks of alternative frequencies
+	} m_settings;
+
+	uint16_t m_tunedFrequency = 0;
+	uint16_t m_candidateFrequency = 0;
+	uint16_t m_expectedPi = 0;
+	uint8_t m_candidateIndex = 0;
+	uint8_t m_weakCount = 0;
+	uint8_t m_tunedRssi = 0;
+	uint16_t m_candidates[RDS_AF_LIST_SIZE];//alternative frequencies copied when attempt started, because AF list can change while candidates are received
+	uint8_t m_candidateCount = 0;
+	uint8_t m_candidateRssi[RDS_AF_LIST_SIZE];//RSSI measured on alternative frequencies in current attempt, 0 if not measured or rejected
+	uint8_t m_piMatches = 0;//number of received groups with expected PI
+	bool m_wasMuted = false;
+	unsigned long m_lastSample = 0;
+	unsigned long m_lastAttempt = 0;
+	unsigned long m_stateStart = 0;
+	unsigned long m_dropoutStart = 0;
+	afFollowerStats m_stats = { 0 };
+
+public:
+	/// <summary>
+	/// Creates AF following engine for given receiver. RDS decoder has to be enabled in receiver.
+	/// Alternative frequency setting mode of receiver is recommended, because it changes frequency without tune operation.
+	/// While alternative frequencies are checked (getState() isn't monitoring), RDS decoding in receiver is held,
+	/// so updateDecodedRdsData() called by application doesn't decode groups from other frequencies.
+	/// </summary>
+	/// <param name="receiver">receiver which will be retuned</param>
+	RDA5807_AfFollower(RDA5807& receiver) : m_receiver(receiver) {}
+
+	RDA5807_AfFollower(const RDA5807_AfFollower&) = delete;
+	RDA5807_AfFollower& operator=(const RDA5807_AfFollower&) = delete;
+
+	/// <summary>
+	/// Starts AF following. Call it after receiver was tuned by application.
+	/// Pass value without decimal place, ex: 919 is 91.9Mhz.
+	/// </summary>
+	/// <param name="freq">currently received frequency</param>
+	void begin(const uint16_t& freq);
+
+	/// <summary>
+	/// Stops AF following. If alternative frequency was being checked, receiver is tuned back and unmuted.
+	/// </summary>
+	void end(void);
+
+	/// <summary>
+	/// Performs next step of AF following. It never waits for receiver, so call it as often as possible, for example in main loop.
+	/// </summary>
+	/// <returns>true if receiver was switched to alternative frequency during this call, false otherwise</returns>
+	bool update(void);
+
+	/// <summary>
+	/// Sets signal thresholds.
+	/// </summary>
+	/// <param name="weakRssi">RSSI below which signal is treated as weak</param>
+	/// <param name="hysteresis">how much RSSI of alternative frequency has to be higher than RSSI of tuned one</param>
+	/// <param name="weakSamples">number of consecutive weak samples which start checking of alternative frequencies</param>
+	void setThresholds(const uint8_t& weakRssi, const uint8_t& hysteresis = 6, const uint8_t& weakSamples = 3)
+	{
+		m_settings.weakRssi = weakRssi;
+		m_settings.hysteresis = hysteresis;
+		m_settings.weakSamples = weakSamples;
+	}
+
+	/// <summary>
+	/// Sets timing of AF following.
+	/// </summary>
+	/// <param name="sampleInterval">time in ms between signal samples</param>
+	/// <param name="settleTime">time in ms to wait after frequency change before signal is measured</param>
+	/// <param name="piTimeout">max time in ms to wait for PI on alternative frequency</param>
+	/// <param name="retryInterval">min time in ms between checks of alternative frequencies</param>
+	void setTiming(const uint16_t& sampleInterval, const uint16_t& settleTime = 10, const uint16_t& piTimeout = 300, const uint16_t& retryInterval = 10000)
+	{
+		m_settings.sampleInterval = sampleInterval;
+		m_settings.settleTime = settleTime;
+		m_settings.piTimeout = piTimeout;
+		m_settings.retryInterval = retryInterval;
+	}
+
+	/// <summary>
+	/// Sets station database filled by other receiver, for example by survey running on dedicated receiver.
+	/// If current station is in database, RSSI of its alternative frequencies is taken from it, so they don't need to be measured and audio dropout is shorter.
+	/// </summary>
+	/// <param name="database">station database, nullptr to always measure alternative frequencies</param>
+	/// <param name="maxAge">max time in ms since station was seen by other receiver, after which its data isn't used</param>
+	void setStationDatabase(const RDA5807_StationDatabase* database, const unsigned long& maxAge = 30000)
+	{
+		m_database = database;
+		m_databaseMaxAge = maxAge;
+	}
+
+	/// <summary>
+	/// Sets signal monitor which decides when signal is weak, instead of single RSSI samples. Monitor is updated by AF following
+	/// only while tuned frequency is received, so don't update it elsewhere. Sample interval and thresholds of monitor are used
+	/// instead of the ones set in AF following, alternative frequencies have to be stronger by hysteresis than average RSSI.
+	/// </summary>
+	/// <param name="monitor">signal monitor, nullptr to use own samples</param>
+	void setSignalMonitor(RDA5807_SignalMonitor* monitor) { m_monitor = monitor; }
+
+	/// <summary>
+	/// Returns current state of AF following.
+	/// </summary>
+	/// <returns>current state</returns>
+	state getState(void) const { return m_state; }
+
+	/// <summary>
+	/// Returns frequency which is received when no alternative frequency is being checked.
+	/// </summary>
+	/// <returns>frequency value, ex: 919 is 91.9Mhz</returns>
+	uint16_t getTunedFrequency(void) const { return m_tunedFrequency; }
+
+	/// <summary>
+	/// Returns statistics of AF following.
+	/// </summary>
+	/// <returns>AF following statistics</returns>
+	const afFollowerStats& getStats(void) const { return m_stats; }
+
+	/// <summary>
+	/// Clears statistics of AF following.
+	/// </summary>
+	void resetStats(void) { m_stats = { 0 }; }
+
+private:
+	/// <summary>
+	/// Samples signal of tuned frequency and starts checking of alternative frequencies when it is too weak.
+	/// </summary>
+	void updateMonitoring(void);
+
+	/// <summary>
+	/// Takes sample of tuned frequency, using signal monitor if it is set.
+	/// </summary>
+	/// <param name="weak">set to true if signal is weak, false otherwise</param>
+	/// <returns>true if sample was taken, false otherwise</returns>
+	bool sampleSignal(bool& weak);
+
+	/// <summary>
+	/// Measures signal on alternative frequency after it settles and remembers the strongest one.
+	/// </summary>
+	void updateCandidateMeasurement(void);
+
+	/// <summary>
+	/// Waits for PI on alternative frequency and switches to it if PI is the same as on tuned frequency.
+	/// </summary>
+	/// <returns>true if receiver was switched to alternative frequency, false otherwise</returns>
+	bool updatePiVerification(void);
+
+	/// <summary>
+	/// Waits until receiver is tuned back to previously received frequency.
+	/// </summary>
+	void updateReturning(void);
+
+	/// <summary>
+	/// Fills RSSI of alternative frequencies using station database.
+	/// </summary>
+	/// <returns>true if at least one alternative frequency was found in database, false otherwise</returns>
+	bool loadCandidatesFromDatabase(void);
+
+	/// <summary>
+	/// Tunes receiver to next alternative frequency. When all were measured, tunes to the strongest one to verify its PI,
+	/// or back to tuned frequency if none is left which is stronger than it by hysteresis value.
+	/// </summary>
+	void startNextCandidate(void);
+
+	/// <summary>
+	/// Tunes receiver to the strongest measured alternative frequency which wasn't rejected yet, to verify its PI.
+	/// </summary>
+	/// <returns>true if there is a candidate stronger than tuned frequency by hysteresis value, false otherwise</returns>
+	bool startStrongestCandidate(void);
+
+	/// <summary>
+	/// Restores mute state from before checking of alternative frequencies and updates dropout statistics.
+	/// </summary>
+	void endDropout(void);
+};
+
+#endif
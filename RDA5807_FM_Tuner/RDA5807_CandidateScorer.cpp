@@ -0,0 +1,177 @@
+/*
+ Name:		RDA5807_CandidateScorer.cpp
+ Created:	19/10/2026 9:06:52 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "RDA5807_CandidateScorer.h"
+#include "RDA5807_Utilities.h"
+
+void RDA5807_CandidateScorer::begin(candidate* candidates, const uint8_t& count)
+{
+	if (candidates == nullptr || !count) return;
+
+	if (m_state == state::disabled) m_wasMuted = m_receiver.getMute();
+	m_receiver.updateMute(true);
+	m_candidates = candidates;
+	m_candidateCount = count;
+	m_index = 0;
+	m_phase = phase::lowerChannel;
+	m_adjacentRssi = 0;
+	startPhase();
+}
+
+void RDA5807_CandidateScorer::end(void)
+{
+	if (m_state == state::disabled) return;
+	m_receiver.updateMute(m_wasMuted);
+	m_receiver.clearDecodedRdsStationData();
+	m_candidates = nullptr;
+	m_state = state::disabled;
+}
+
+bool RDA5807_CandidateScorer::update(void)
+{
+	switch (m_state)
+	{
+	case state::settling:
+		if ((millis() - m_stateStart) < m_settings.settleTime) return false;
+		if (!m_receiver.checkIfTuneIsComplete() && (millis() - m_stateStart) <= (m_settings.settleTime * 10UL)) return false;//after timeout channel is measured anyway
+		m_stateStart = millis();
+		m_state = state::sampling;
+		updateSampling();//status registers were just read
+		return m_state == state::complete;
+
+	case state::sampling:
+		if ((millis() - m_stateStart) < m_settings.sampleInterval) return false;
+		m_stateStart = millis();
+		if (!m_receiver.updateStatusRegisters()) return false;
+		updateSampling();
+		return m_state == state::complete;
+
+	default:
+		return false;
+	}
+}
+
+uint8_t RDA5807_CandidateScorer::calculateScore(const candidate& data)
+{
+	uint8_t score = 0;
+
+	score += ((data.rssi > 50) ? 50 : data.rssi) * 30 / 50;//up to 30 points, stronger signal than that doesn't make channel more likely to be a station
+	if (data.adjacentDifference > 0) score += ((data.adjacentDifference > 20) ? 20 : data.adjacentDifference) * 25 / 20;//up to 25 points, splatter and images are weaker than adjacent channel
+	score += data.stereoPercent * 15 / 100;//up to 15 points
+	score += (data.rdsPercent * (100 - data.blockErrorPercent)) / 500;//up to 20 points
+	if (data.programmeIdentification) score += 10;
+	return score;
+}
+
+void RDA5807_CandidateScorer::startPhase(void)
+{
+	uint16_t first = 0;
+	uint16_t last = 0;
+	uint16_t frequency = m_candidates[m_index].frequency;
+
+	RDA5807_Utilities::getBandLimits(first, last, m_receiver.getBand(), !m_receiver.get65mMode());
+	if (m_phase == phase::lowerChannel)
+	{
+		if (frequency < (first + m_settings.adjacentOffset)) m_phase = phase::upperChannel;//there is no adjacent channel below band
+		else frequency -= m_settings.adjacentOffset;
+	}
+	if (m_phase == phase::upperChannel)
+	{
+		if ((frequency + m_settings.adjacentOffset) > last) m_phase = phase::candidateChannel;
+		else frequency += m_settings.adjacentOffset;
+	}
+	if (m_phase == phase::candidateChannel)
+	{
+		m_sample = 0;
+		m_rssiSum = 0;
+		m_stereoSamples = 0;
+		m_rdsSamples = 0;
+		m_rdsBlocks = 0;
+		m_rdsBlockErrors = 0;
+		m_receiver.clearDecodedRdsStationData();//PI from other channel can't be assigned to this one
+	}
+
+	m_receiver.startFrequencyChange(frequency);//if it fails, channel will be measured after timeout
+	m_stateStart = millis();
+	m_state = state::settling;
+}
+
+void RDA5807_CandidateScorer::updateSampling(void)
+{
+	if (m_phase != phase::candidateChannel)
+	{
+		if (m_receiver.getRssi() > m_adjacentRssi) m_adjacentRssi = m_receiver.getRssi();
+		m_phase = (m_phase == phase::lowerChannel) ? phase::upperChannel : phase::candidateChannel;
+		startPhase();
+		return;
+	}
+
+	m_rssiSum += m_receiver.getRssi();
+	if (m_receiver.getStereoIndicator()) m_stereoSamples++;
+	if (m_receiver.getRdsSynchronizationState())
+	{
+		m_rdsSamples++;
+		if (m_receiver.getRdsGroupState())
+		{//error levels are valid only for received group
+			m_rdsBlocks += 2;
+			if (m_receiver.getBlockErrorsLevelOfRdsData0() == RDA5807::blockErrorLevel::bel6AndMoreErrors) m_rdsBlockErrors++;
+			if (m_receiver.getBlockErrorsLevelOfRdsData1() == RDA5807::blockErrorLevel::bel6AndMoreErrors) m_rdsBlockErrors++;
+			if (m_receiver.updateRdsData()) m_receiver.updateDecodedRdsData();
+		}
+	}
+	if (++m_sample >= m_settings.samples) finishCandidate();
+}
+
+void RDA5807_CandidateScorer::finishCandidate(void)
+{
+	candidate& data = m_candidates[m_index];
+	const RdsDecoder* const rds = m_receiver.getDecodedRdsData();
+	const int16_t difference = static_cast<int16_t>(m_rssiSum / m_sample) - m_adjacentRssi;
+
+	data.rssi = static_cast<uint8_t>(m_rssiSum / m_sample);
+	data.adjacentDifference = static_cast<int8_t>((difference > 127) ? 127 : ((difference < -128) ? -128 : difference));
+	data.stereoPercent = static_cast<uint8_t>((m_stereoSamples * 100U) / m_sample);
+	data.rdsPercent = static_cast<uint8_t>((m_rdsSamples * 100U) / m_sample);
+	data.blockErrorPercent = m_rdsBlocks ? static_cast<uint8_t>((m_rdsBlockErrors * 100UL) / m_rdsBlocks) : 0;
+	data.programmeIdentification = (rds != nullptr) ? rds->getConfirmedProgrammeIdentification() : 0;
+	data.score = calculateScore(data);
+
+	if (++m_index >= m_candidateCount)
+	{
+		rankCandidates();
+		m_state = state::complete;
+		return;
+	}
+	m_phase = phase::lowerChannel;
+	m_adjacentRssi = 0;
+	startPhase();
+}
+
+void RDA5807_CandidateScorer::rankCandidates(void)
+{
+	for (uint8_t i = 1; i < m_candidateCount; i++)
+	{//insertion sort, number of candidates is small
+		const candidate data = m_candidates[i];
+		uint8_t j = i;
+
+		for (; j > 0 && m_candidates[j - 1].score < data.score; j--) m_candidates[j] = m_candidates[j - 1];
+		m_candidates[j] = data;
+	}
+
+	uint8_t count = 0;
+	for (uint8_t i = 0; i < m_candidateCount; i++)
+	{
+		if (m_candidates[i].score < m_settings.minScore) break;//rest is sorted, so it is rejected too
+
+		bool duplicate = false;
+		for (uint8_t j = 0; j < count && !duplicate; j++)
+			duplicate = m_candidates[i].programmeIdentification && m_candidates[j].programmeIdentification == m_candidates[i].programmeIdentification;
+		if (!duplicate) m_candidates[count++] = m_candidates[i];//the best frequency of station is kept
+	}
+	m_candidateCount = count;
+}
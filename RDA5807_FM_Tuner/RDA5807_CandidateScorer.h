@@ -0,0 +1,172 @@
+/*
+ Name:		RDA5807_CandidateScorer.h
+ Created:	19/10/2026 9:06:52 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _RDA5807_CANDIDATESCORER_h
+#define _RDA5807_CANDIDATESCORER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "RDA5807_FM_Tuner.h"
+
+class RDA5807_CandidateScorer final
+{
+public:
+	/// <summary>
+	/// Channel which can be a station, for example stop found by seek or peak found by spectrum sweep.
+	/// </summary>
+	struct candidate
+	{
+		uint16_t frequency;//set by application, ex: 919 is 91.9Mhz
+		uint16_t programmeIdentification;//confirmed PI, 0 if it wasn't received
+		uint8_t rssi;//average RSSI
+		int8_t adjacentDifference;//average RSSI minus RSSI of the stronger adjacent channel, negative if adjacent channel is stronger
+		uint8_t stereoPercent;//percent of samples with stereo
+		uint8_t rdsPercent;//percent of samples with RDS synchronization
+		uint8_t blockErrorPercent;//percent of RDS blocks A and B with errors which couldn't be corrected
+		uint8_t score;//from 0 to 100
+	};
+
+private:
+	/// <summary>
+	/// Possible states of scoring.
+	/// </summary>
+	enum class state : uint8_t { disabled, settling, sampling, complete };
+
+	/// <summary>
+	/// Possible channels measured for one candidate.
+	/// </summary>
+	enum class phase : uint8_t { lowerChannel, upperChannel, candidateChannel };
+
+	RDA5807& m_receiver;
+	state m_state = state::disabled;
+	phase m_phase = phase::lowerChannel;
+
+	/// <summary>
+	/// Settings of scoring.
+	/// </summary>
+	struct
+	{
+		uint8_t minScore = 40;//score below which candidate is rejected
+		uint8_t samples = 8;//number of status reads on candidate channel
+		uint16_t sampleInterval = 25;//time in ms between status reads
+		uint16_t settleTime = 10;//time in ms to wait after frequency change before signal is measured
+		uint8_t adjacentOffset = 1;//distance to adjacent channels, ex: 1 is 100kHz
+	} m_settings;
+
+	candidate* m_candidates = nullptr;
+	uint8_t m_candidateCount = 0;
+	uint8_t m_index = 0;
+	uint8_t m_adjacentRssi = 0;//RSSI of the stronger adjacent channel
+	uint8_t m_sample = 0;
+	uint16_t m_rssiSum = 0;
+	uint8_t m_stereoSamples = 0;
+	uint8_t m_rdsSamples = 0;
+	uint16_t m_rdsBlocks = 0;
+	uint16_t m_rdsBlockErrors = 0;
+	bool m_wasMuted = false;
+	unsigned long m_stateStart = 0;
+
+public:
+	/// <summary>
+	/// Creates scoring stage which rejects channels that aren't real stations, like images and splatter next to strong transmitters.
+	/// Score is calculated from RSSI, RSSI difference to adjacent channels, stereo pilot, RDS synchronization and RDS block errors.
+	/// RDS decoder has to be enabled in receiver to merge candidates with the same PI.
+	/// </summary>
+	/// <param name="receiver">receiver which will be retuned</param>
+	RDA5807_CandidateScorer(RDA5807& receiver) : m_receiver(receiver) {}
+
+	RDA5807_CandidateScorer(const RDA5807_CandidateScorer&) = delete;
+	RDA5807_CandidateScorer& operator=(const RDA5807_CandidateScorer&) = delete;
+
+	/// <summary>
+	/// Starts scoring of candidates. Only frequency has to be set in every candidate, other fields are filled during scoring.
+	/// When scoring is completed, array is sorted by score, rejected candidates and duplicates with the same PI are removed.
+	/// Audio is muted until scoring is ended.
+	/// </summary>
+	/// <param name="candidates">array of candidates, it has to exist until scoring is completed</param>
+	/// <param name="count">number of candidates</param>
+	void begin(candidate* candidates, const uint8_t& count);
+
+	/// <summary>
+	/// Stops scoring and restores mute state. Tune receiver to desired frequency after that.
+	/// </summary>
+	void end(void);
+
+	/// <summary>
+	/// Performs next step of scoring. It never waits for receiver, so call it as often as possible, for example in main loop.
+	/// </summary>
+	/// <returns>true if scoring was completed during this call, false otherwise</returns>
+	bool update(void);
+
+	/// <summary>
+	/// Sets score below which candidate is rejected.
+	/// </summary>
+	/// <param name="minScore">score from 0 to 100</param>
+	void setMinScore(const uint8_t& minScore) { m_settings.minScore = minScore; }
+
+	/// <summary>
+	/// Sets sampling of candidates. Longer sampling gives more reliable score and more time to receive PI.
+	/// </summary>
+	/// <param name="samples">number of status reads on candidate channel, from 1 to 255</param>
+	/// <param name="sampleInterval">time in ms between status reads</param>
+	/// <param name="settleTime">time in ms to wait after frequency change before signal is measured</param>
+	/// <param name="adjacentOffset">distance to adjacent channels, ex: 1 is 100kHz</param>
+	void setSampling(const uint8_t& samples, const uint16_t& sampleInterval = 25, const uint16_t& settleTime = 10, const uint8_t& adjacentOffset = 1)
+	{
+		m_settings.samples = samples ? samples : 1;
+		m_settings.sampleInterval = sampleInterval;
+		m_settings.settleTime = settleTime;
+		m_settings.adjacentOffset = adjacentOffset;
+	}
+
+	/// <summary>
+	/// Returns information if scoring was completed.
+	/// </summary>
+	/// <returns>true if scoring is completed, false otherwise</returns>
+	bool getComplete(void) const { return m_state == state::complete; }
+
+	/// <summary>
+	/// Returns number of accepted candidates. Valid after scoring is completed.
+	/// </summary>
+	/// <returns>number of candidates</returns>
+	uint8_t getCandidateCount(void) const { return m_candidateCount; }
+
+	/// <summary>
+	/// Calculates score of candidate from its measurements.
+	/// </summary>
+	/// <param name="data">measured candidate</param>
+	/// <returns>score from 0 to 100</returns>
+	static uint8_t calculateScore(const candidate& data);
+
+private:
+	/// <summary>
+	/// Tunes receiver to channel measured in current phase.
+	/// </summary>
+	void startPhase(void);
+
+	/// <summary>
+	/// Takes sample of channel measured in current phase.
+	/// </summary>
+	void updateSampling(void);
+
+	/// <summary>
+	/// Saves measurements of candidate and moves to next one.
+	/// </summary>
+	void finishCandidate(void);
+
+	/// <summary>
+	/// Sorts candidates by score, removes rejected ones and duplicates with the same PI.
+	/// </summary>
+	void rankCandidates(void);
+};
+
+#endif
@@ -7,52 +7,172 @@
 */
 
 #include "RDA5807_FM_Tuner.h"
+#include "RDA5807_Utilities.h"
 
 void RDA5807::i2cWriteShort(const uint16_t& data)
 {
-	Wire.write(static_cast<uint8_t>((data & 0xFF00) >> 8));
-	Wire.write(static_cast<uint8_t>(data & 0x00FF));
+	m_wire->write(static_cast<uint8_t>((data & 0xFF00) >> 8));
+	m_wire->write(static_cast<uint8_t>(data & 0x00FF));
 }
 
 uint16_t RDA5807::i2cReadShort(void)
 {
-	uint16_t data = Wire.read();
+	uint16_t data = m_wire->read();
 	data <<= 8;
-	data |= Wire.read();
+	data |= m_wire->read();
 	return data;
 }
 
-void RDA5807::i2cWriteRegister(const uint8_t& reg, const uint16_t& value)
+bool RDA5807::i2cBeginTransaction(i2cStatus& status, const uint8_t& attempt)
 {
-	Wire.beginTransmission(0x11);
-	Wire.write(reg);
-	i2cWriteShort(value);
-	Wire.endTransmission();
+	if (attempt)
+	{//wait before repeating transaction, doubling stops at max delay which is accurate on every platform
+		uint16_t wait = m_i2cSettings.backoffTime;
+		for (uint8_t i = 1; i < attempt && wait < (RDA5807_I2C_MAX_BACKOFF_TIME / 2); i++) wait <<= 1;
+		delayMicroseconds((wait < RDA5807_I2C_MAX_BACKOFF_TIME) ? wait : RDA5807_I2C_MAX_BACKOFF_TIME);
+	}
+	else if (getI2cHoldoff()) status = i2cStatus::busHoldoff;
+	else if (m_i2cBusSelector != nullptr && !m_i2cBusSelector(m_i2cBusSelectorContext, *this)) status = i2cStatus::busSelectFailed;
+	else return true;
+
+	m_i2cHealth.lastStatus = status;
+	return false;
 }
 
-uint16_t RDA5807::i2cReadRegister(const uint8_t& reg)
+bool RDA5807::i2cEndTransaction(i2cStatus& status, const uint8_t& bytes, const uint8_t& attempt)
 {
-	Wire.beginTransmission(0x11);
-	Wire.write(reg);
-	Wire.endTransmission(false);
-	Wire.requestFrom(0x11, 2);
-	return i2cReadShort();
+#if RDA5807_I2C_FAULT_INJECTION
+	if (m_i2cFaults.busStuck) status = i2cStatus::timeout;
+	else if (m_i2cFaults.nackCount) { m_i2cFaults.nackCount--; status = i2cStatus::addressNack; }
+#endif
+	m_i2cHealth.transactions++;
+	m_i2cHealth.lastStatus = status;
+	if (attempt) m_i2cHealth.retries++;
+
+	if (status == i2cStatus::ok)
+	{
+		m_i2cHealth.bytesTransferred += bytes;
+		m_i2cHealth.consecutiveFailures = 0;
+		return true;
+	}
+	if (attempt < m_i2cSettings.retries) return false;//repeat transaction
+
+	m_i2cHealth.failures++;
+	if (m_i2cHealth.consecutiveFailures < 0xFF) m_i2cHealth.consecutiveFailures++;
+	if (m_i2cSettings.failuresBeforeRecovery && !(m_i2cHealth.consecutiveFailures % m_i2cSettings.failuresBeforeRecovery))
+	{//receiver stopped answering, try to release the bus and give it some time before next transaction
+		recoverI2cBus();
+		m_i2cHoldoff = true;
+		m_i2cHoldoffStart = millis();
+	}
+	return true;
 }
 
-void RDA5807::writeSettingsToReceiver(void)
+RDA5807::i2cStatus RDA5807::i2cWriteRegister(const uint8_t& reg, const uint16_t& value)
 {
-	Wire.beginTransmission(0x10);
-	i2cWriteShort(m_rdaWriteRegisters.reg02.regValue);
-	i2cWriteShort(m_rdaWriteRegisters.reg03.regValue);
-	i2cWriteShort(m_rdaWriteRegisters.reg04.regValue);
-	i2cWriteShort(m_rdaWriteRegisters.reg05.regValue);
-	i2cWriteShort(m_rdaWriteRegisters.reg06.regValue);
-	i2cWriteShort(m_rdaWriteRegisters.reg07.regValue);
-	i2cWriteShort(m_rdaWriteRegisters.reg08.regValue);
-	Wire.endTransmission();
+	i2cStatus status = i2cStatus::busHoldoff;
+
+	for (uint8_t attempt = 0; i2cBeginTransaction(status, attempt); attempt++)
+	{
+		m_wire->beginTransmission(0x11);
+		m_wire->write(reg);
+		i2cWriteShort(value);
+		status = static_cast<i2cStatus>(m_wire->endTransmission());
+		if (i2cEndTransaction(status, 3, attempt)) break;
+	}
+	return status;
 }
 
-void RDA5807::writeModifiedRegistersToReceiver(void)
+RDA5807::i2cStatus RDA5807::i2cReadRegister(const uint8_t& reg, uint16_t& value)
+{
+	i2cStatus status = i2cStatus::busHoldoff;
+
+	for (uint8_t attempt = 0; i2cBeginTransaction(status, attempt); attempt++)
+	{
+		m_wire->beginTransmission(0x11);
+		m_wire->write(reg);
+		status = static_cast<i2cStatus>(m_wire->endTransmission(false));
+		if (status == i2cStatus::ok)
+		{
+			if (m_wire->requestFrom(0x11, 2) == 2) value = i2cReadShort();
+			else status = i2cStatus::incompleteRead;
+		}
+		while (m_wire->available()) m_wire->read();//drop data left after incomplete read
+		if (i2cEndTransaction(status, 3, attempt)) break;
+	}
+	return status;
+}
+
+RDA5807::i2cStatus RDA5807::i2cWriteSequentialRegisters(const uint8_t& count)
+{
+	const uint16_t* const writeRegs[] =
+	{
+		&m_rdaWriteRegisters.reg02.regValue,
+		&m_rdaWriteRegisters.reg03.regValue,
+		&m_rdaWriteRegisters.reg04.regValue,
+		&m_rdaWriteRegisters.reg05.regValue,
+		&m_rdaWriteRegisters.reg06.regValue,
+		&m_rdaWriteRegisters.reg07.regValue,
+		&m_rdaWriteRegisters.reg08.regValue
+	};
+	uint16_t* const writeRegsCheck[] =
+	{
+		&m_rdaWriteRegistersCheck.reg02,
+		&m_rdaWriteRegistersCheck.reg03,
+		&m_rdaWriteRegistersCheck.reg04,
+		&m_rdaWriteRegistersCheck.reg05,
+		&m_rdaWriteRegistersCheck.reg06,
+		&m_rdaWriteRegistersCheck.reg07,
+		&m_rdaWriteRegistersCheck.reg08
+	};
+	i2cStatus status = i2cStatus::busHoldoff;
+
+	for (uint8_t attempt = 0; i2cBeginTransaction(status, attempt); attempt++)
+	{
+		m_wire->beginTransmission(0x10);
+		for (uint8_t i = 0; i < count; i++) i2cWriteShort(*writeRegs[i]);
+		status = static_cast<i2cStatus>(m_wire->endTransmission());
+		if (i2cEndTransaction(status, count * 2, attempt)) break;
+	}
+	if (status == i2cStatus::ok)
+	{
+		for (uint8_t i = 0; i < count; i++) *writeRegsCheck[i] = *writeRegs[i];//receiver now holds the same values
+		m_forcedWriteRegisters &= static_cast<uint8_t>(0xFF << count);
+	}
+	return status;
+}
+
+RDA5807::i2cStatus RDA5807::i2cReadSequentialRegisters(const uint8_t& count)
+{
+	uint16_t* const readRegs[] =
+	{
+		&m_rdaReadRegisters.reg0A.regValue,
+		&m_rdaReadRegisters.reg0B.regValue,
+		&m_rdaReadRegisters.reg0C.regValue,
+		&m_rdaReadRegisters.reg0D.regValue,
+		&m_rdaReadRegisters.reg0E.regValue,
+		&m_rdaReadRegisters.reg0F.regValue
+	};
+	i2cStatus status = i2cStatus::busHoldoff;
+
+	for (uint8_t attempt = 0; i2cBeginTransaction(status, attempt); attempt++)
+	{
+		status = i2cStatus::ok;
+		if (m_wire->requestFrom(0x10, count * 2) == count * 2)//two bytes for each register
+			for (uint8_t i = 0; i < count; i++) *readRegs[i] = i2cReadShort();
+		else status = i2cStatus::incompleteRead;
+		while (m_wire->available()) m_wire->read();//drop data left after incomplete read
+		if (i2cEndTransaction(status, count * 2, attempt)) break;
+	}
+	return status;
+}
+
+bool RDA5807::writeSettingsToReceiver(void)
+{
+	return i2cWriteSequentialRegisters(7) == i2cStatus::ok;
+}
+
+bool RDA5807::writeModifiedRegistersToReceiver(void)
 {
 	uint16_t* const writeRegs[] =
 	{
@@ -74,152 +194,264 @@ void RDA5807::writeModifiedRegistersToReceiver(void)
 		&m_rdaWriteRegistersCheck.reg07,
 		&m_rdaWriteRegistersCheck.reg08
 	};
+	bool result = true;
 
 	for (uint8_t i = 0; i < 7; i++)
 	{
-		if (*writeRegsCheck[i] != *writeRegs[i])//check if value has changed
+		if (*writeRegsCheck[i] != *writeRegs[i] || (m_forcedWriteRegisters & (1 << i)))//check if value has changed
 		{
-			i2cWriteRegister(i, *writeRegs[i]);//update value in receiver
-			*writeRegsCheck[i] = *writeRegs[i];//update value in check struct
+			if (i2cWriteRegister(i + 0x02, *writeRegs[i]) == i2cStatus::ok)
+			{//update value in receiver and then in check struct
+				*writeRegsCheck[i] = *writeRegs[i];
+				m_forcedWriteRegisters &= static_cast<uint8_t>(~(1 << i));
+			}
+			else result = false;//leave check struct unchanged, so next call will try again
 		}
 	}
+	return result;
+}
+
+bool RDA5807::writeModifiedRegistersInBurst(void)
+{
+	uint8_t count = 0;
+
+	if (!getModifiedRegistersWritePlan(count)) return true;//nothing to write
+	if (!count) return writeModifiedRegistersToReceiver();
+
+	if (!(m_forcedWriteRegisters & 0x01) && m_rdaWriteRegistersCheck.reg02 == m_rdaWriteRegisters.reg02.regValue) setSeek(false);//value is written again, so bits which start operations must be cleared
+	if (count > 1 && !(m_forcedWriteRegisters & 0x02) && m_rdaWriteRegistersCheck.reg03 == m_rdaWriteRegisters.reg03.regValue) setTune(false);
+	return i2cWriteSequentialRegisters(count) == i2cStatus::ok;
+}
+
+uint8_t RDA5807::getModifiedRegistersWriteSize(void)
+{
+	uint8_t count = 0;
+
+	return getModifiedRegistersWritePlan(count);
+}
+
+uint8_t RDA5807::getModifiedRegistersWritePlan(uint8_t& sequentialCount)
+{
+	const uint16_t writeRegs[] =
+	{
+		m_rdaWriteRegisters.reg02.regValue,
+		m_rdaWriteRegisters.reg03.regValue,
+		m_rdaWriteRegisters.reg04.regValue,
+		m_rdaWriteRegisters.reg05.regValue,
+		m_rdaWriteRegisters.reg06.regValue,
+		m_rdaWriteRegisters.reg07.regValue,
+		m_rdaWriteRegisters.reg08.regValue
+	};
+	const uint16_t writeRegsCheck[] =
+	{
+		m_rdaWriteRegistersCheck.reg02,
+		m_rdaWriteRegistersCheck.reg03,
+		m_rdaWriteRegistersCheck.reg04,
+		m_rdaWriteRegistersCheck.reg05,
+		m_rdaWriteRegistersCheck.reg06,
+		m_rdaWriteRegistersCheck.reg07,
+		m_rdaWriteRegistersCheck.reg08
+	};
+	uint8_t separateSize = 0;
+	uint8_t last = 0;
+
+	for (uint8_t i = 0; i < 7; i++)
+	{
+		if (writeRegsCheck[i] == writeRegs[i] && !(m_forcedWriteRegisters & (1 << i))) continue;
+		separateSize += 4;//address, register number and two bytes of value
+		last = i + 1;
+	}
+	if (!last) return 0;
+
+	const uint8_t sequentialSize = 1 + (last * 2);//address and two bytes for each register
+	if (sequentialSize <= separateSize)
+	{
+		sequentialCount = last;
+		return sequentialSize;
+	}
+	sequentialCount = 0;
+	return separateSize;
+}
+
+bool RDA5807::transaction::commit(void)
+{
+	if (!m_active) return true;
+	m_active = false;
+	if (--m_receiver.m_transactionDepth) return true;//outermost transaction will write all changes
+	return m_receiver.writeModifiedRegistersInBurst();
 }
 
 bool RDA5807::readSettingsFromReceiver(void)
 {
-	Wire.requestFrom(0x10, 12);//6 registers, two bytes each
-	if (Wire.available() != 12) return false;
-	m_rdaReadRegisters.reg0A.regValue = i2cReadShort();
-	m_rdaReadRegisters.reg0B.regValue = i2cReadShort();
-	m_rdaReadRegisters.reg0C.regValue = i2cReadShort();
-	m_rdaReadRegisters.reg0D.regValue = i2cReadShort();
-	m_rdaReadRegisters.reg0E.regValue = i2cReadShort();
-	m_rdaReadRegisters.reg0F.regValue = i2cReadShort();
-	return true;
+	return i2cReadSequentialRegisters(6) == i2cStatus::ok;//6 registers, two bytes each
 }
 
-void RDA5807::updateMute(const bool& setting)
+bool RDA5807::updateMute(const bool& setting)
 {
-	setMute(setting);
+	transaction changes(*this);
 
-	i2cWriteRegister(0x02, m_rdaWriteRegisters.reg02.regValue);
+	setMute(setting);
+	return changes.commit();
 }
 
-void RDA5807::updateVolumeLevel(const uint8_t& value)
+bool RDA5807::updateVolumeLevel(const uint8_t& value)
 {
 	uint8_t level = 0;
 
 	if (value) level = static_cast<uint8_t>(value / 0x10);
+	transaction changes(*this);
 	setVolume(level);
-
-	i2cWriteRegister(0x05, m_rdaWriteRegisters.reg05.regValue);
+	return changes.commit();
 }
 
 bool RDA5807::updateReceivedFrequency(const uint16_t& freq)
 {
-	uint8_t channelSpacingValue = 0;
-	uint16_t channel = 0;
-	bool otherEastEuropeBand = !get65mMode();
-
-	if (otherEastEuropeBand && (freq < 500)) return false;
-	if (freq < 650 || freq > 1080) return false;//freq value can't be set outside working range of receiver
-
-	switch (getBand())
-	{
-	case band::usEurope:
-		if (freq == 870) break;
-		channel = (freq - 870) * 100;
-		if (channel > 21000) return false;
-		break;
-	case band::japan:
-		if (freq == 760) break;
-		channel = (freq - 760) * 100;
-		if (channel > 15000) return false;
-		break;
-	case band::worldWide:
-		if (channel == 760) break;
-		channel = (freq - 760) * 100;
-		if (channel > 32000) return false;
-		break;
-	case band::eastEurope:
-		if (otherEastEuropeBand) { if (freq == 500) break; channel = (freq - 500) * 100; if (channel > 26000) return false; }
-		else { if (freq == 650) break; channel = (freq - 650) * 100; if (channel > 11000) return false; }
-		break;
-	}
+	uint16_t offset = 0;
 
-	switch (getChannelSpacing())
-	{
-	case channelSpacing::spc25kHz:
-		channelSpacingValue = 25;
-		break;
-	case channelSpacing::spc50kHz:
-		channelSpacingValue = 50;
-		break;
-	case channelSpacing::spc100kHz:
-		channelSpacingValue = 100;
-		break;
-	case channelSpacing::spc200kHz:
-		channelSpacingValue = 200;
-		break;
-	}
+	if (!RDA5807_Utilities::getFrequencyOffset(freq, offset, getBand(), !get65mMode())) return false;//freq value can't be set outside selected band
+	resetRdsProgrammeIdentification(freq);
 
 	if (getAlternativeFrequencySettingMode())
 	{//freq = min band freq kHz + freq direct kHz
-		setFrequencyDirectly(channel);
+		transaction changes(*this);
 
-		i2cWriteRegister(0x07, m_rdaWriteRegisters.reg07.regValue);//write this again to be able to receive music instead of hum
-		i2cWriteRegister(0x08, m_rdaWriteRegisters.reg08.regValue);
+		setFrequencyDirectly(offset);
+		forceRegisterWrite(0x07);//write this again to be able to receive music instead of hum
+		forceRegisterWrite(0x08);
+		return changes.commit();
 	}
 	else
 	{//standard freq setting mode
-		if (channel) channel /= channelSpacingValue;
-		setChannel(channel);
+		transaction changes(*this);
+
+		setChannel(offset / RDA5807_Utilities::getChannelSpacingValue(getChannelSpacing()));
+		setTune();//tune operation is started by the same write, also when registers are written by outer transaction
+		forceRegisterWrite(0x02);//receiving will start working after sending this register second time here
+		forceRegisterWrite(0x03);
+		if (m_transactionDepth > 1) return true;
+		if (!changes.commit()) return false;
+
+		const unsigned long tuneStart = millis();
+		do
+		{//wait for receiver to tune, only status is read, so tune isn't restarted, and don't stall caller if it stops answering
+			if (i2cReadRegister(0x0A, m_rdaReadRegisters.reg0A.regValue) != i2cStatus::ok) return false;
+			if ((millis() - tuneStart) > m_i2cSettings.tuneTimeout) return false;
+		} while (!getSeekTuneComplete());
+	}
+
+	return true;
+}
+
+bool RDA5807::convertFrequencyToChannel(const uint16_t& freq, uint16_t& channel)
+{
+	return RDA5807_Utilities::getChannelValue(freq, channel, getChannelSpacing(), getBand(), !get65mMode());
+}
 
-		i2cWriteRegister(0x02, m_rdaWriteRegisters.reg02.regValue);//receiving will start working after sending this register second time here
-		i2cWriteRegister(0x03, m_rdaWriteRegisters.reg03.regValue);
+bool RDA5807::startFrequencyChange(const uint16_t& freq)
+{
+	uint16_t offset = 0;
+
+	if (!RDA5807_Utilities::getFrequencyOffset(freq, offset, getBand(), !get65mMode())) return false;
+	resetRdsProgrammeIdentification(freq);
+
+	if (getAlternativeFrequencySettingMode()) return startDirectFrequencyChange(offset);//no tune operation in this mode, receiver changes frequency after register write
+
+	transaction changes(*this);
+	setChannel(offset / RDA5807_Utilities::getChannelSpacingValue(getChannelSpacing()));
+	setTune();
+	forceRegisterWrite(0x03);
+	return changes.commit();
+}
+
+bool RDA5807::startDirectFrequencyChange(const uint16_t& offset)
+{
+	transaction changes(*this);
+
+	setFrequencyDirectly(offset);
+	forceRegisterWrite(0x08);
+	return changes.commit();
+}
 
-		do { m_rdaReadRegisters.reg0A.regValue = i2cReadRegister(0x0A); updateTune(); } while (!getSeekTuneComplete());//wait for receiver to tune
+bool RDA5807::getFrequencyRegisterValue(const uint16_t& freq, uint16_t& value)
+{
+	uint16_t offset = 0;
+
+	if (!RDA5807_Utilities::getFrequencyOffset(freq, offset, getBand(), !get65mMode())) return false;
+	if (getAlternativeFrequencySettingMode())
+	{
+		value = offset;
+		return true;
 	}
 
+	const uint16_t channel = offset / RDA5807_Utilities::getChannelSpacingValue(getChannelSpacing());
+	value = static_cast<uint16_t>((m_rdaWriteRegisters.reg03.regValue & 0x002F) | (channel << 6) | 0x0010);//channel in bits 6-15, tune bit 4, other settings stay unchanged
 	return true;
 }
 
-void RDA5807::updateRssi(void)
+bool RDA5807::startFrequencyChangeFromRegisterValue(const uint16_t& value)
 {
-	m_rdaReadRegisters.reg0B.regValue = i2cReadRegister(0x0B);
+	const bool direct = getAlternativeFrequencySettingMode();
+	uint16_t& reg = direct ? m_rdaWriteRegisters.reg08.regValue : m_rdaWriteRegisters.reg03.regValue;
+	const uint16_t& regCheck = direct ? m_rdaWriteRegistersCheck.reg08 : m_rdaWriteRegistersCheck.reg03;
+
+	if (!m_seekStarted && reg == value && regCheck == value) return true;//receiver is already set to this frequency
+	transaction changes(*this);
+	reg = value;
+	resetRdsProgrammeIdentification();
+	forceRegisterWrite(direct ? 0x08 : 0x03);//written even if only local value differed
+	if (!changes.commit()) return false;
+	m_seekStarted = false;
+	return true;
 }
 
-void RDA5807::updateSeek(void)
+bool RDA5807::checkIfTuneIsComplete(void)
 {
-	setSeek();
+	if (!updateStatusRegisters()) return false;
+	return getAlternativeFrequencySettingMode() || getSeekTuneComplete();
+}
 
-	i2cWriteRegister(0x02, m_rdaWriteRegisters.reg02.regValue);
+bool RDA5807::updateRssi(void)
+{
+	return i2cReadRegister(0x0B, m_rdaReadRegisters.reg0B.regValue) == i2cStatus::ok;
 }
 
-void RDA5807::updateTune(void)
+bool RDA5807::updateSeek(void)
 {
-	setTune();
+	transaction changes(*this);
 
-	i2cWriteRegister(0x03, m_rdaWriteRegisters.reg03.regValue);
+	setSeek();
+	forceRegisterWrite(0x02);//seek bit can be already set after previous seek
+	resetRdsProgrammeIdentification();
+	return changes.commit();
+}
+
+bool RDA5807::updateTune(void)
+{
+	transaction changes(*this);
+
+	setTune();
+	forceRegisterWrite(0x03);//tune bit can be already set after previous tune
+	resetRdsProgrammeIdentification();
+	return changes.commit();
 }
 
 bool RDA5807::checkIfNewRdsDataIsReady(void)
 {
-	m_rdaReadRegisters.reg0A.regValue = i2cReadRegister(0x0A);
+	if (i2cReadRegister(0x0A, m_rdaReadRegisters.reg0A.regValue) != i2cStatus::ok) return false;
 	return getRdsGroupState();
 }
 
-void RDA5807::updateRdsData(void)
+bool RDA5807::updateRdsData(void)
 {
-	m_rdaReadRegisters.reg0C.regValue = i2cReadRegister(0x0C);
-	m_rdaReadRegisters.reg0D.regValue = i2cReadRegister(0x0D);
-	m_rdaReadRegisters.reg0E.regValue = i2cReadRegister(0x0E);
-	m_rdaReadRegisters.reg0F.regValue = i2cReadRegister(0x0F);
+	if (i2cReadRegister(0x0C, m_rdaReadRegisters.reg0C.regValue) != i2cStatus::ok) return false;
+	if (i2cReadRegister(0x0D, m_rdaReadRegisters.reg0D.regValue) != i2cStatus::ok) return false;
+	if (i2cReadRegister(0x0E, m_rdaReadRegisters.reg0E.regValue) != i2cStatus::ok) return false;
+	return i2cReadRegister(0x0F, m_rdaReadRegisters.reg0F.regValue) == i2cStatus::ok;
 }
 
 RdsDecoder::groupType RDA5807::updateDecodedRdsData(void)
 {
-	if (m_rdsDecoder != nullptr) return m_rdsDecoder->decodeReceivedData();
+	if (m_rdsDecoder != nullptr && !m_rdsDecodingHeld) return m_rdsDecoder->decodeReceivedData();
 	return RdsDecoder::groupType::none;
 }
 
@@ -228,3 +460,100 @@ const RdsDecoder* const RDA5807::getDecodedRdsData(void)
 	if (m_rdsDecoder != nullptr) return m_rdsDecoder;
 	return nullptr;
 }
+
+void RDA5807::clearDecodedRdsStationData(void)
+{
+	if (m_rdsDecoder != nullptr) m_rdsDecoder->clearStationData();
+}
+
+bool RDA5807::registerOpenDataApplication(const uint16_t& applicationId, RdsDecoder::odaHandler handler, void* context)
+{
+	if (m_rdsDecoder != nullptr) return m_rdsDecoder->registerOpenDataApplication(applicationId, handler, context);
+	return false;
+}
+
+void RDA5807::unregisterOpenDataApplication(const uint16_t& applicationId)
+{
+	if (m_rdsDecoder != nullptr) m_rdsDecoder->unregisterOpenDataApplication(applicationId);
+}
+
+bool RDA5807::recoverI2cBus(void)
+{
+	const uint8_t& scl = m_i2cSettings.sclPin;
+	const uint8_t& sda = m_i2cSettings.sdaPin;
+	bool released = false;
+
+	m_i2cHealth.busRecoveries++;
+#if RDA5807_I2C_FAULT_INJECTION
+	m_i2cFaults.busStuck = false;
+#endif
+	if (scl == 0xFF || sda == 0xFF) return false;
+
+	m_wire->end();
+	pinMode(sda, INPUT_PULLUP);
+	pinMode(scl, INPUT_PULLUP);
+	for (uint8_t i = 0; (i < 9) && (digitalRead(sda) == LOW); i++)
+	{//clock out bits until slave releases SDA, lines are only pulled low or released
+		digitalWrite(scl, LOW);
+		pinMode(scl, OUTPUT);
+		delayMicroseconds(5);
+		pinMode(scl, INPUT_PULLUP);
+		delayMicroseconds(5);
+	}
+	digitalWrite(sda, LOW);//generate STOP condition, SDA goes high while SCL is high
+	pinMode(sda, OUTPUT);
+	delayMicroseconds(5);
+	pinMode(sda, INPUT_PULLUP);
+	delayMicroseconds(5);
+	released = (digitalRead(sda) == HIGH) && (digitalRead(scl) == HIGH);
+
+	m_wire->begin();
+	if (m_i2cSettings.busClock) m_wire->setClock(m_i2cSettings.busClock);
+	return released;
+}
+
+bool RDA5807::getI2cHoldoff(void)
+{
+	if (m_i2cHoldoff && ((millis() - m_i2cHoldoffStart) >= m_i2cSettings.holdoffTime)) m_i2cHoldoff = false;
+	return m_i2cHoldoff;
+}
+
+bool RDA5807::updateStatusRegisters(void)
+{
+	return i2cReadSequentialRegisters(2) == i2cStatus::ok;
+}
+
+bool RDA5807::checkIfReceiverWasReset(void)
+{
+	uint16_t reg02 = 0;
+	const uint16_t selfClearingBits = 0x0102;//seek and soft reset bits are cleared by receiver
+
+	if (!getEnable()) return false;//receiver disabled on purpose, there is nothing to compare
+	m_watchdogStats.checks++;
+	if (!updateStatusRegisters()) return false;
+	if (getFmReadinessState()) return false;//enabled and ready, so it still works with our settings
+	if (i2cReadRegister(0x02, reg02) != i2cStatus::ok) return false;
+	return (reg02 & ~selfClearingBits) != (m_rdaWriteRegisters.reg02.regValue & ~selfClearingBits);
+}
+
+bool RDA5807::restoreReceiverSettings(void)
+{
+	setTune();//retune after writing, used only in standard frequency setting mode
+	return writeSettingsToReceiver();
+}
+
+bool RDA5807::updateWatchdog(void)
+{
+	unsigned long checkStart = 0;
+
+	if (!m_watchdogInterval || ((millis() - m_watchdogLastCheck) < m_watchdogInterval)) return false;
+	m_watchdogLastCheck = millis();
+
+	checkStart = micros();
+	if (!checkIfReceiverWasReset()) return false;
+	m_watchdogStats.resets++;
+	if (!restoreReceiverSettings()) m_watchdogStats.failedRestores++;
+	m_watchdogStats.lastRecoveryTime = micros() - checkStart;
+	if (m_watchdogStats.lastRecoveryTime > m_watchdogStats.maxRecoveryTime) m_watchdogStats.maxRecoveryTime = m_watchdogStats.lastRecoveryTime;
+	return true;
+}
@@ -29,6 +29,14 @@ uint8_t getEnumValue(const Enumerator& enumType)
 
 #endif // ENUM_CONVERSION
 
+#ifndef RDA5807_I2C_FAULT_INJECTION
+#define RDA5807_I2C_FAULT_INJECTION 0//set to 1 to be able to inject I2C faults for testing
+#endif
+
+#ifndef RDA5807_I2C_MAX_BACKOFF_TIME
+#define RDA5807_I2C_MAX_BACKOFF_TIME 16383//max delay in us before repeated transaction, larger values aren't accurate in delayMicroseconds on AVR
+#endif
+
 class RDA5807 final
 {
 public:
@@ -96,10 +104,83 @@ public:
 	/// Possible RDS block errors level values.
 	/// </summary>
 	enum class blockErrorLevel : uint8_t { bel0Errors, bel1to2Errors, bel3to5Errors, bel6AndMoreErrors };
+	/// <summary>
+	/// Possible results of I2C transaction. Values from ok to otherError are the same as values returned by Wire.endTransmission().
+	/// </summary>
+	enum class i2cStatus : uint8_t { ok, dataTooLong, addressNack, dataNack, otherError, timeout, incompleteRead, busHoldoff, busSelectFailed };
 #pragma endregion
+#pragma region RDA structs
+	/// <summary>
+	/// Health record of I2C communication with receiver.
+	/// </summary>
+	struct i2cHealth
+	{
+		uint32_t transactions;//number of all transactions sent to the bus, including retries
+		uint32_t bytesTransferred;//number of bytes sent and received, without address bytes
+		uint16_t failures;//number of transactions which failed after all retries
+		uint16_t retries;//number of repeated transactions
+		uint16_t busRecoveries;//number of bus recovery attempts
+		uint8_t consecutiveFailures;//number of failed transactions since last successful one
+		i2cStatus lastStatus;//result of last transaction
+	};
+
+	/// <summary>
+	/// Statistics of receiver reset watchdog.
+	/// </summary>
+	struct watchdogStats
+	{
+		uint32_t checks;//number of performed health checks
+		uint16_t resets;//number of detected receiver resets
+		uint16_t failedRestores;//number of resets after which settings couldn't be restored
+		uint32_t lastRecoveryTime;//time in us from start of health check which detected reset to end of settings restore
+		uint32_t maxRecoveryTime;//max time in us of all recoveries
+	};
+#pragma endregion
+
+	/// <summary>
+	/// Function called before every transaction, which has to make receiver reachable on its I2C bus,
+	/// for example by selecting its channel in I2C multiplexer.
+	/// </summary>
+	/// <param name="context">pointer passed during setting of the bus</param>
+	/// <param name="receiver">receiver which will start transaction</param>
+	/// <returns>true if receiver is reachable, false if transaction has to be abandoned</returns>
+	typedef bool(*i2cBusSelector)(void* context, const RDA5807& receiver);
+
+	/// <summary>
+	/// Scoped transaction which collects changes of settings made with setXxx() and updateXxx() methods
+	/// and writes them to receiver when it ends, using writeModifiedRegistersInBurst(). Transactions can be nested,
+	/// then changes are written when the outermost one ends and updateXxx() methods called inside only change local settings.
+	/// </summary>
+	class transaction final
+	{
+		RDA5807& m_receiver;
+		bool m_active = true;
+
+	public:
+		/// <summary>
+		/// Starts transaction.
+		/// </summary>
+		/// <param name="receiver">receiver which settings will be changed</param>
+		transaction(RDA5807& receiver) : m_receiver(receiver) { m_receiver.m_transactionDepth++; }
+
+		transaction(const transaction&) = delete;
+		transaction& operator=(const transaction&) = delete;
+
+		/// <summary>
+		/// Ends transaction if it wasn't committed before.
+		/// </summary>
+		~transaction() { commit(); }
+
+		/// <summary>
+		/// Ends transaction before end of scope. Next calls do nothing.
+		/// </summary>
+		/// <returns>true if all modified registers were written or transaction is nested, false otherwise</returns>
+		bool commit(void);
+	};
 
 private:
 	RdsDecoder* m_rdsDecoder = nullptr;
+	bool m_rdsDecodingHeld = false;//set while other frequencies are checked briefly, so their groups don't replace data of received station
 #pragma region RDA write registers
 	struct RDAWriteRegisters
 	{
@@ -331,6 +412,53 @@ private:
 		m_rdaWriteRegisters.reg08.regValue
 	};
 #pragma endregion
+#pragma region I2C settings
+	/// <summary>
+	/// Settings used for handling I2C communication errors.
+	/// </summary>
+	struct
+	{
+		uint8_t retries = 2;//number of repeated transactions after first failed one
+		uint16_t backoffTime = 100;//delay in us before first repeated transaction, doubled with every next one up to RDA5807_I2C_MAX_BACKOFF_TIME
+		uint8_t failuresBeforeRecovery = 3;//number of consecutive failed transactions after which bus recovery is performed
+		uint16_t holdoffTime = 500;//time in ms after bus recovery during which transactions are not sent to the bus
+		uint16_t tuneTimeout = 100;//max time in ms to wait for tune operation to complete
+		uint32_t busClock = 0;//clock set after bus recovery, 0 to leave default value
+#if defined(PIN_WIRE_SCL) && defined(PIN_WIRE_SDA)
+		uint8_t sclPin = PIN_WIRE_SCL;
+		uint8_t sdaPin = PIN_WIRE_SDA;
+#else
+		uint8_t sclPin = 0xFF;//0xFF disables bus recovery
+		uint8_t sdaPin = 0xFF;
+#endif
+	} m_i2cSettings;
+
+	TwoWire* m_wire = &Wire;//bus on which receiver is connected
+	i2cBusSelector m_i2cBusSelector = nullptr;
+	void* m_i2cBusSelectorContext = nullptr;
+	i2cHealth m_i2cHealth = { 0 };
+	unsigned long m_i2cHoldoffStart = 0;
+	bool m_i2cHoldoff = false;
+	uint8_t m_transactionDepth = 0;//number of not ended transactions
+	uint8_t m_forcedWriteRegisters = 0;//registers which have to be written even if they weren't modified, bit 0 is register 0x02
+	bool m_seekStarted = false;//seek changes channel without touching register 0x03, so its written value may be not received anymore
+
+#pragma region watchdog settings
+	uint16_t m_watchdogInterval = 1000;//time in ms between health checks, 0 to disable
+	unsigned long m_watchdogLastCheck = 0;
+	watchdogStats m_watchdogStats = { 0 };
+#pragma endregion
+#if RDA5807_I2C_FAULT_INJECTION
+	/// <summary>
+	/// Faults which will be reported instead of real transaction results.
+	/// </summary>
+	struct
+	{
+		uint8_t nackCount;//number of next transactions which will end with address NACK
+		bool busStuck;//true if all transactions have to end with timeout until bus recovery is performed
+	} m_i2cFaults = { 0 };
+#endif
+#pragma endregion
 private:
 	/// <summary>
 	/// Writes short to I2C slave.
@@ -344,30 +472,108 @@ private:
 	/// <returns>read data</returns>
 	uint16_t i2cReadShort(void);
 
+	/// <summary>
+	/// Checks if next attempt of transaction can be sent to the bus and selects receiver on it. Waits before repeated attempts.
+	/// </summary>
+	/// <param name="status">set to reason of abandoning transaction</param>
+	/// <param name="attempt">number of attempt, starting from 0</param>
+	/// <returns>true if transaction can be sent, false if bus is in holdoff state or receiver couldn't be selected</returns>
+	bool i2cBeginTransaction(i2cStatus& status, const uint8_t& attempt);
+
+	/// <summary>
+	/// Updates health record using result of transaction and decides if it has to be repeated.
+	/// Performs bus recovery when too many consecutive transactions failed.
+	/// </summary>
+	/// <param name="status">result of transaction, can be replaced by injected fault</param>
+	/// <param name="bytes">number of transferred bytes</param>
+	/// <param name="attempt">number of attempt, starting from 0</param>
+	/// <returns>true if transaction is finished, false if it has to be repeated</returns>
+	bool i2cEndTransaction(i2cStatus& status, const uint8_t& bytes, const uint8_t& attempt);
+
 	/// <summary>
 	/// Writes short to specified register.
 	/// </summary>
 	/// <param name="reg">destination register</param>
 	/// <param name="value">data to write</param>
-	void i2cWriteRegister(const uint8_t& reg, const uint16_t& value);
+	/// <returns>result of transaction</returns>
+	i2cStatus i2cWriteRegister(const uint8_t& reg, const uint16_t& value);
 
 	/// <summary>
-	/// Reads short from specified register.
+	/// Reads short from specified register. Value is updated only after a successful read operation.
 	/// </summary>
 	/// <param name="reg">source register</param>
-	/// <returns>read data</returns>
-	uint16_t i2cReadRegister(const uint8_t& reg);
+	/// <param name="value">destination for read data</param>
+	/// <returns>result of transaction</returns>
+	i2cStatus i2cReadRegister(const uint8_t& reg, uint16_t& value);
+
+	/// <summary>
+	/// Writes locally stored registers to receiver in one transaction, starting from register 0x02.
+	/// Copies of written registers are updated after a successful write operation.
+	/// </summary>
+	/// <param name="count">number of registers to write, from 1 to 7</param>
+	/// <returns>result of transaction</returns>
+	i2cStatus i2cWriteSequentialRegisters(const uint8_t& count);
+
+	/// <summary>
+	/// Reads registers from receiver in one transaction, starting from register 0x0A.
+	/// Locally stored registers are updated only after a successful read operation.
+	/// </summary>
+	/// <param name="count">number of registers to read, from 1 to 6</param>
+	/// <returns>result of transaction</returns>
+	i2cStatus i2cReadSequentialRegisters(const uint8_t& count);
+
+	/// <summary>
+	/// Finds cheaper way of writing modified registers, see writeModifiedRegistersInBurst().
+	/// </summary>
+	/// <param name="sequentialCount">destination for number of registers of sequential write, 0 if separate writes are cheaper</param>
+	/// <returns>number of bytes, including address bytes, 0 if no register was modified</returns>
+	uint8_t getModifiedRegistersWritePlan(uint8_t& sequentialCount);
+
+	/// <summary>
+	/// Resets confirmation of PI code in RDS decoder, so identity of station is checked again after frequency change.
+	/// </summary>
+	/// <param name="freq">new frequency, ex: 919 is 91.9Mhz, 0 if it isn't known (ex: after seek)</param>
+	void resetRdsProgrammeIdentification(const uint16_t& freq = 0) { if (m_rdsDecoder != nullptr) m_rdsDecoder->resetProgrammeIdentification(freq); }
+
+	/// <summary>
+	/// Marks register to be written by next write of modified registers even if its value wasn't changed,
+	/// for example to start seek or tune operation again.
+	/// </summary>
+	/// <param name="reg">register number, from 0x02 to 0x08</param>
+	void forceRegisterWrite(const uint8_t& reg) { m_forcedWriteRegisters |= static_cast<uint8_t>(1 << (reg - 0x02)); }
 
 public:
 	/// <summary>
 	/// Writes all settings to registers 0x02 to 0x08.
 	/// </summary>
-	void writeSettingsToReceiver(void);
+	/// <returns>true if all data was written, false otherwise</returns>
+	bool writeSettingsToReceiver(void);
 
 	/// <summary>
 	/// Writes settings only from modified registers to receiver.
 	/// </summary>
-	void writeModifiedRegistersToReceiver(void);
+	/// <returns>true if all modified registers were written, false otherwise</returns>
+	bool writeModifiedRegistersToReceiver(void);
+
+	/// <summary>
+	/// Writes settings only from modified registers to receiver, choosing the way which needs fewer bytes on the bus:
+	/// one sequential write starting from register 0x02 up to the last modified register, or separate write of every modified register.
+	/// Seek and tune bits of not modified registers are cleared before sequential write, so it won't start seek or tune again.
+	/// </summary>
+	/// <returns>true if all modified registers were written, false otherwise</returns>
+	bool writeModifiedRegistersInBurst(void);
+
+	/// <summary>
+	/// Returns number of bytes, including address bytes, which writeModifiedRegistersInBurst() would send to receiver now.
+	/// </summary>
+	/// <returns>number of bytes, 0 if no register was modified</returns>
+	uint8_t getModifiedRegistersWriteSize(void);
+
+	/// <summary>
+	/// Returns number of transactions which are started and not ended yet, see RDA5807::transaction.
+	/// </summary>
+	/// <returns>depth of nested transactions, 0 if no transaction is started</returns>
+	uint8_t getTransactionDepth(void) const { return m_transactionDepth; }
 
 	/// <summary>
 	/// Reads settings from registers 0x0A to 0x0F.
@@ -380,48 +586,108 @@ public:
 	/// Changes mute state.
 	/// </summary>
 	/// <param name="setting">true to mute, false to unmute</param>
-	void updateMute(const bool& setting);
+	/// <returns>true if setting was written to receiver or will be written by outer transaction, false otherwise</returns>
+	bool updateMute(const bool& setting);
 
 	/// <summary>
 	/// Changes volume level. Min = 0, Max = 0xFF.
 	/// </summary>
 	/// <param name="value">volume level value</param>
-	void updateVolumeLevel(const uint8_t& value);
+	/// <returns>true if setting was written to receiver or will be written by outer transaction, false otherwise</returns>
+	bool updateVolumeLevel(const uint8_t& value);
 
 	/// <summary>
 	/// Changes received frequency. Min and Max depends on selected band. If passed value is out of selected band, then nothing is changed.
 	/// Frequency is setted according to frequency setting mode (standard or direct).
 	/// Pass value without decimal place, ex: 919 will set receiver to 91.9Mhz, 1080 will set frequency to 108Mhz etc.
+	/// In standard mode it waits for tune operation to complete, but not longer than time set by setTuneTimeout().
+	/// Inside transaction registers are written when the outermost transaction ends and it doesn't wait.
 	/// </summary>
 	/// <param name="freq">frequency to set</param>
-	/// <returns>true if change was made successfuly, false if nothing was changed</returns>
+	/// <returns>true if change was made successfuly, false if nothing was changed, communication failed or tune operation timed out</returns>
 	bool updateReceivedFrequency(const uint16_t& freq);
 
+	/// <summary>
+	/// Converts frequency to channel value using selected band and channel spacing. Can be used with RdsDecoder::getAlternativeFrequency().
+	/// Pass value without decimal place, ex: 919 is 91.9Mhz.
+	/// </summary>
+	/// <param name="freq">frequency to convert</param>
+	/// <param name="channel">destination for channel value</param>
+	/// <returns>true if frequency is inside selected band, false otherwise</returns>
+	bool convertFrequencyToChannel(const uint16_t& freq, uint16_t& channel);
+
+	/// <summary>
+	/// Starts change of received frequency without waiting for it to complete. Only one register is written:
+	/// 0x08 in alternative frequency setting mode (all registers need to be written once before, see writeSettingsToReceiver()) or 0x03 in standard mode.
+	/// Use checkIfTuneIsComplete() to check when receiver is tuned. Pass value without decimal place, ex: 919 will set receiver to 91.9Mhz.
+	/// Other locally modified registers are written together with it, inside transaction all of them are written when the outermost transaction ends.
+	/// </summary>
+	/// <param name="freq">frequency to set</param>
+	/// <returns>true if change was started, false if frequency is out of selected band or communication failed</returns>
+	bool startFrequencyChange(const uint16_t& freq);
+
+	/// <summary>
+	/// Starts change of received frequency in alternative frequency setting mode with 1kHz resolution. Only register 0x08 is written,
+	/// so all registers need to be written once before with alternative frequency setting mode enabled, see writeSettingsToReceiver().
+	/// </summary>
+	/// <param name="offset">offset in kHz from the beginning of selected band, see RDA5807_Utilities::getFrequencyOffset()</param>
+	/// <returns>true if change was started, false if communication failed</returns>
+	bool startDirectFrequencyChange(const uint16_t& offset);
+
+	/// <summary>
+	/// Prepares value of register used for frequency change: 0x03 with channel and tune bit in standard mode, or 0x08 in alternative frequency setting mode.
+	/// Value is valid as long as band, channel spacing and frequency setting mode aren't changed. Pass value without decimal place, ex: 919 is 91.9Mhz.
+	/// </summary>
+	/// <param name="freq">frequency to convert</param>
+	/// <param name="value">destination for register value</param>
+	/// <returns>true if frequency is inside selected band, false otherwise</returns>
+	bool getFrequencyRegisterValue(const uint16_t& freq, uint16_t& value);
+
+	/// <summary>
+	/// Starts change of received frequency using value prepared by getFrequencyRegisterValue(), without waiting for it to complete.
+	/// Register is written only if value differs from the one already written to receiver, or if seek was started after it was written.
+	/// Use checkIfTuneIsComplete() to check when receiver is tuned.
+	/// </summary>
+	/// <param name="value">register value</param>
+	/// <returns>true if change was started or receiver already received this frequency, false if communication failed</returns>
+	bool startFrequencyChangeFromRegisterValue(const uint16_t& value);
+
+	/// <summary>
+	/// Updates registers 0x0A and 0x0B and returns information if tune operation started by startFrequencyChange() completed.
+	/// In alternative frequency setting mode there is no tune operation, so it only updates registers.
+	/// </summary>
+	/// <returns>true if receiver is tuned, false otherwise or if communication failed</returns>
+	bool checkIfTuneIsComplete(void);
+
 	/// <summary>
 	/// Updates RSSI value.
 	/// </summary>
-	void updateRssi(void);
+	/// <returns>true if value was updated, false otherwise</returns>
+	bool updateRssi(void);
 
 	/// <summary>
 	/// Starts seek operation.
 	/// </summary>
-	void updateSeek(void);
+	/// <returns>true if operation was started or will be started by outer transaction, false otherwise</returns>
+	bool updateSeek(void);
 
 	/// <summary>
 	/// Starts tune operation.
 	/// </summary>
-	void updateTune(void);
+	/// <returns>true if operation was started or will be started by outer transaction, false otherwise</returns>
+	bool updateTune(void);
 
 	/// <summary>
 	/// Returns information about new RDS data avability.
 	/// </summary>
-	/// <returns>true if new data is ready, false otherwise</returns>
+	/// <returns>true if new data is ready, false otherwise or if communication failed</returns>
 	bool checkIfNewRdsDataIsReady(void);
 
 	/// <summary>
 	/// Updates locally stored RDS data using data from receiver.
 	/// </summary>
-	void updateRdsData(void);
+	/// <returns>true if all blocks were updated, false otherwise</returns>
+	bool updateRdsData(void);
 
 	/// <summary>
 	/// Decodes locally stored RDS data and returns type of received RDS group.
@@ -429,12 +695,181 @@ public:
 	/// <returns>type of received RDS group. If RDA5807 was created without RDS data decoding option, then it will return groupType::none</returns>
 	RdsDecoder::groupType updateDecodedRdsData(void);
 
+	/// <summary>
+	/// Holds decoding of RDS data, updateDecodedRdsData() returns groupType::none until hold is released.
+	/// Used while other frequencies are checked briefly (ex: by AF following), so their groups don't replace data of received station.
+	/// </summary>
+	/// <param name="setting">true to hold decoding, false to release it</param>
+	void setRdsDecodingHold(const bool& setting = true) { m_rdsDecodingHeld = setting; }
+
+	/// <summary>
+	/// Returns information if decoding of RDS data is held.
+	/// </summary>
+	/// <returns>true if decoding is held, false otherwise</returns>
+	bool getRdsDecodingHold(void) const { return m_rdsDecodingHeld; }
+
 	/// <summary>
 	/// Returns pointer to object which contains decoded RDS data.
 	/// </summary>
 	/// <returns>pointer to RdsDecoder object with decoded RDS data. It will be nullptr if RDA5807 was created without RDS data decoding option</returns>
 	const RdsDecoder* const getDecodedRdsData(void);
 
+	/// <summary>
+	/// Clears decoded RDS data which belongs to received station: PS, PTYN, RadioText, AF list, other networks, traffic messages
+	/// and assignment of groups to Open Data Applications. Use it after tuning to other station.
+	/// </summary>
+	void clearDecodedRdsStationData(void);
+
+	/// <summary>
+	/// Registers handler of (ODA) Open Data Application. Groups assigned to this application in group 3A will be passed to handler
+	/// instead of being decoded as standard groups. Registering handler for AID which already has one replaces it.
+	/// </summary>
+	/// <param name="applicationId">(AID) Application Identification code</param>
+	/// <param name="handler">function which decodes application data</param>
+	/// <param name="context">pointer passed to handler, ex: object which stores decoded data</param>
+	/// <returns>true if handler was registered, false if there is no free slot or RDA5807 was created without RDS data decoding option</returns>
+	bool registerOpenDataApplication(const uint16_t& applicationId, RdsDecoder::odaHandler handler, void* context = nullptr);
+
+	/// <summary>
+	/// Removes handler of (ODA) Open Data Application with given AID.
+	/// </summary>
+	/// <param name="applicationId">(AID) Application Identification code</param>
+	void unregisterOpenDataApplication(const uint16_t& applicationId);
+
+	/// <summary>
+	/// Sets RBDS mode of RDS decoder, used in north America. It changes only interpretation of decoded data, decoding itself is the same.
+	/// </summary>
+	/// <param name="setting">true if RBDS has to be used, false if RDS</param>
+	void setRbdsMode(const bool& setting = true) { if (m_rdsDecoder != nullptr) m_rdsDecoder->m_rbdsMode = setting; }
+
+#pragma region I2C error handling
+	/// <summary>
+	/// Sets I2C bus on which receiver is connected. By default Wire is used.
+	/// If receiver is behind I2C multiplexer, pass function which selects its channel, it will be called before every transaction.
+	/// Don't read registers in constructor of such receiver, because bus isn't set at that time.
+	/// </summary>
+	/// <param name="wire">I2C bus</param>
+	/// <param name="selector">function which makes receiver reachable on the bus, nullptr if it isn't needed</param>
+	/// <param name="context">pointer which will be passed to selector</param>
+	void setI2cBus(TwoWire& wire, i2cBusSelector selector = nullptr, void* context = nullptr)
+	{
+		m_wire = &wire;
+		m_i2cBusSelector = selector;
+		m_i2cBusSelectorContext = context;
+	}
+
+	/// <summary>
+	/// Returns I2C bus on which receiver is connected.
+	/// </summary>
+	/// <returns>I2C bus</returns>
+	TwoWire& getI2cBus(void) const { return *m_wire; }
+
+	/// <summary>
+	/// Sets how many times failed transaction will be repeated and how long to wait before repeating it.
+	/// Wait time is doubled with every next repeated transaction, but it never exceeds RDA5807_I2C_MAX_BACKOFF_TIME.
+	/// </summary>
+	/// <param name="retries">number of repeated transactions, 0 to disable</param>
+	/// <param name="backoffTime">wait time in us before first repeated transaction</param>
+	void setI2cRetries(const uint8_t& retries, const uint16_t& backoffTime = 100) { m_i2cSettings.retries = retries; m_i2cSettings.backoffTime = backoffTime; }
+
+	/// <summary>
+	/// Sets bus recovery parameters. After given number of consecutive failed transactions SCL is toggled until slave releases SDA,
+	/// then Wire is reinitialized and no transactions are sent to the bus for holdoff time, so a hung receiver will not stall the caller.
+	/// </summary>
+	/// <param name="sclPin">pin connected to SCL line, 0xFF to disable toggling of SCL</param>
+	/// <param name="sdaPin">pin connected to SDA line, 0xFF to disable toggling of SCL</param>
+	/// <param name="failuresBeforeRecovery">number of consecutive failed transactions which triggers recovery</param>
+	/// <param name="holdoffTime">time in ms during which transactions are not sent after recovery</param>
+	/// <param name="busClock">clock to set after Wire is reinitialized, 0 to leave default value</param>
+	void setI2cBusRecovery(const uint8_t& sclPin, const uint8_t& sdaPin, const uint8_t& failuresBeforeRecovery = 3, const uint16_t& holdoffTime = 500, const uint32_t& busClock = 0)
+	{
+		m_i2cSettings.sclPin = sclPin;
+		m_i2cSettings.sdaPin = sdaPin;
+		m_i2cSettings.failuresBeforeRecovery = failuresBeforeRecovery;
+		m_i2cSettings.holdoffTime = holdoffTime;
+		m_i2cSettings.busClock = busClock;
+	}
+
+	/// <summary>
+	/// Sets max time to wait for tune operation to complete in updateReceivedFrequency().
+	/// </summary>
+	/// <param name="timeout">time in ms</param>
+	void setTuneTimeout(const uint16_t& timeout) { m_i2cSettings.tuneTimeout = timeout; }
+
+	/// <summary>
+	/// Performs bus recovery. Toggles SCL (max 9 times) until SDA is released by slave, generates STOP condition and reinitializes Wire.
+	/// </summary>
+	/// <returns>true if both lines are released after recovery, false otherwise or if recovery pins are not set</returns>
+	bool recoverI2cBus(void);
+
+	/// <summary>
+	/// Returns health record of I2C communication with receiver.
+	/// </summary>
+	/// <returns>health record</returns>
+	const i2cHealth& getI2cHealth(void) const { return m_i2cHealth; }
+
+	/// <summary>
+	/// Clears health record of I2C communication with receiver.
+	/// </summary>
+	void resetI2cHealth(void) { m_i2cHealth = { 0 }; }
+
+	/// <summary>
+	/// Returns information if transactions are currently not sent to the bus because of recent bus recovery.
+	/// </summary>
+	/// <returns>true if in holdoff state, false otherwise</returns>
+	bool getI2cHoldoff(void);
+
+#pragma endregion
+#pragma region watchdog
+	/// <summary>
+	/// Updates registers 0x0A and 0x0B using one read operation.
+	/// </summary>
+	/// <returns>true if values were updated, false otherwise</returns>
+	bool updateStatusRegisters(void);
+
+	/// <summary>
+	/// Checks if receiver lost its settings, for example after brown-out. Registers 0x0A and 0x0B are read in one operation and if enabled receiver
+	/// is not ready, register 0x02 is read and compared with locally stored value to confirm that receiver returned to power-on defaults.
+	/// </summary>
+	/// <returns>true if receiver lost its settings, false otherwise or if communication failed</returns>
+	bool checkIfReceiverWasReset(void);
+
+	/// <summary>
+	/// Writes all locally stored settings to receiver in one operation and starts tune operation, so receiver continues to work with settings it had before reset.
+	/// </summary>
+	/// <returns>true if settings were restored, false otherwise</returns>
+	bool restoreReceiverSettings(void);
+
+	/// <summary>
+	/// Performs health check if time set by setWatchdogInterval() elapsed since last check and restores receiver settings if it was reset.
+	/// Call this method periodically, for example in main loop.
+	/// </summary>
+	/// <returns>true if reset was detected during this call, false otherwise</returns>
+	bool updateWatchdog(void);
+
+	/// <summary>
+	/// Sets time between health checks performed by updateWatchdog().
+	/// </summary>
+	/// <param name="interval">time in ms, 0 to disable health checks</param>
+	void setWatchdogInterval(const uint16_t& interval) { m_watchdogInterval = interval; }
+
+	/// <summary>
+	/// Returns statistics of receiver reset watchdog.
+	/// </summary>
+	/// <returns>watchdog statistics</returns>
+	const watchdogStats& getWatchdogStats(void) const { return m_watchdogStats; }
+#pragma endregion
+#pragma region I2C fault injection
+#if RDA5807_I2C_FAULT_INJECTION
+	/// <summary>
+	/// Injects faults into I2C communication. Used only during testing.
+	/// </summary>
+	/// <param name="nackCount">number of next transactions which will end with address NACK</param>
+	/// <param name="busStuck">true if all transactions have to end with timeout until bus recovery is performed</param>
+	void injectI2cFaults(const uint8_t& nackCount, const bool& busStuck = false) { m_i2cFaults.nackCount = nackCount; m_i2cFaults.busStuck = busStuck; }
+#endif
+#pragma endregion
+
 #pragma region registers get and set	
 	/// <summary>
 	/// Writes given value to locally stored register 00.
@@ -696,7 +1131,11 @@ public:
 	/// <param name="setting">true to start seek, false otherwise</param>
 	void setSeek(const bool& setting = true)
 	{
-		if (setting) m_rdaWriteRegisters.reg02.regValues.seek = static_cast<uint8_t>(1);
+		if (setting)
+		{
+			m_rdaWriteRegisters.reg02.regValues.seek = static_cast<uint8_t>(1);
+			m_seekStarted = true;
+		}
 		else m_rdaWriteRegisters.reg02.regValues.seek = static_cast<uint8_t>(0);
 	}
 	/// <summary>
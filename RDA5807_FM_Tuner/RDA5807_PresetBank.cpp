@@ -0,0 +1,97 @@
+/*
+ Name:		RDA5807_PresetBank.cpp
+ Created:	19/10/2026 11:24:17 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "RDA5807_PresetBank.h"
+
+bool RDA5807_PresetBank::storePreset(const uint8_t& index, const uint16_t& freq, const uint16_t& programmeIdentification)
+{
+	uint16_t value = 0;
+
+	if (index >= RDA5807_PRESET_COUNT || !m_receiver.getFrequencyRegisterValue(freq, value)) return false;
+	m_presets[index].frequency = freq;
+	m_presets[index].programmeIdentification = programmeIdentification;
+	m_presets[index].registerValue = value;
+	m_presets[index].configuration = getConfiguration();
+	return true;
+}
+
+bool RDA5807_PresetBank::setPreset(const uint8_t& index, const preset& data)
+{
+	if (index >= RDA5807_PRESET_COUNT) return false;
+	m_presets[index] = data;
+	return true;
+}
+
+bool RDA5807_PresetBank::recallPreset(const uint8_t& index)
+{
+	const unsigned long start = micros();
+
+	if (index >= RDA5807_PRESET_COUNT || !m_presets[index].frequency) return false;
+
+	preset& data = m_presets[index];
+	const uint8_t configuration = getConfiguration();
+	if (data.configuration != configuration)
+	{//band, spacing or mode was changed since preset was stored
+		if (!m_receiver.getFrequencyRegisterValue(data.frequency, data.registerValue)) return false;
+		data.configuration = configuration;
+		m_stats.preparedValues++;
+	}
+
+	const uint32_t transactions = m_receiver.getI2cHealth().transactions;
+	if (!m_receiver.startFrequencyChangeFromRegisterValue(data.registerValue)) return false;
+	if (transactions == m_receiver.getI2cHealth().transactions) m_stats.unchangedRecalls++;
+	m_stats.recalls++;
+	m_stats.lastRecallTime = static_cast<uint16_t>(micros() - start);
+	return true;
+}
+
+bool RDA5807_PresetBank::updateProgrammeIdentification(const uint8_t& index)
+{
+	const RdsDecoder* const rds = m_receiver.getDecodedRdsData();
+
+	if (index >= RDA5807_PRESET_COUNT || !m_presets[index].frequency || rds == nullptr || !rds->getConfirmedProgrammeIdentification()) return false;
+	m_presets[index].programmeIdentification = rds->getConfirmedProgrammeIdentification();
+	return true;
+}
+
+RDA5807_PresetBank::preset RDA5807_PresetBank::getPreset(const uint8_t& index) const
+{
+	if (index >= RDA5807_PRESET_COUNT) return { 0 };
+	return m_presets[index];
+}
+
+uint8_t RDA5807_PresetBank::findPreset(const uint16_t& programmeIdentification) const
+{
+	if (!programmeIdentification) return 0xFF;
+	for (uint8_t i = 0; i < RDA5807_PRESET_COUNT; i++)
+		if (m_presets[i].frequency && m_presets[i].programmeIdentification == programmeIdentification) return i;
+	return 0xFF;
+}
+
+bool RDA5807_PresetBank::getPresetStation(const uint8_t& index, RDA5807_StationDatabase::station& dest) const
+{
+	if (m_database == nullptr || index >= RDA5807_PRESET_COUNT || !m_presets[index].frequency) return false;
+	if (m_presets[index].programmeIdentification) return m_database->findStation(m_presets[index].programmeIdentification, dest);
+
+	for (uint8_t i = 0; i < m_database->getStationCount(); i++)
+	{
+		if (!m_database->getStation(i, dest)) continue;
+		for (uint8_t j = 0; j < dest.frequencyCount; j++)
+			if (dest.frequencies[j] == m_presets[index].frequency) return true;
+	}
+	return false;
+}
+
+uint8_t RDA5807_PresetBank::getConfiguration(void)
+{
+	uint8_t configuration = static_cast<uint8_t>(m_receiver.getReg03() & 0x000F);//band and channel spacing
+
+	if (m_receiver.getAlternativeFrequencySettingMode()) configuration |= 0x10;
+	if (m_receiver.get65mMode()) configuration |= 0x20;
+	return configuration;
+}
@@ -0,0 +1,152 @@
+/*
+ Name:		RDA5807_PresetBank.h
+ Created:	19/10/2026 11:24:17 AM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _RDA5807_PRESETBANK_h
+#define _RDA5807_PRESETBANK_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "RDA5807_FM_Tuner.h"
+#include "RDA5807_StationDatabase.h"
+
+#ifndef RDA5807_PRESET_COUNT
+#define RDA5807_PRESET_COUNT 8//number of presets in bank
+#endif
+
+class RDA5807_PresetBank final
+{
+public:
+	/// <summary>
+	/// Stored favorite station. Can be saved in EEPROM and loaded with setPreset().
+	/// </summary>
+	struct preset
+	{
+		uint16_t frequency;//ex: 919 is 91.9Mhz, 0 if preset is empty
+		uint16_t programmeIdentification;//PI of station, 0 if it is unknown
+		uint16_t registerValue;//value of register 0x03 or 0x08, see RDA5807::getFrequencyRegisterValue()
+		uint8_t configuration;//band, channel spacing and frequency setting mode for which registerValue was prepared
+	};
+
+	/// <summary>
+	/// Statistics of recalls.
+	/// </summary>
+	struct presetStats
+	{
+		uint16_t recalls;//number of successful recalls
+		uint16_t unchangedRecalls;//number of recalls of frequency which was already received, nothing was written
+		uint16_t preparedValues;//number of register values prepared again because receiver configuration changed
+		uint16_t lastRecallTime;//time in us of last recall
+	};
+
+private:
+	RDA5807& m_receiver;
+	const RDA5807_StationDatabase* m_database = nullptr;
+	preset m_presets[RDA5807_PRESET_COUNT];
+	presetStats m_stats = { 0 };
+
+public:
+	/// <summary>
+	/// Creates bank of presets. Every preset holds prepared register value, so recall needs only one register write
+	/// instead of frequency conversion, two writes and waiting for tune like RDA5807::updateReceivedFrequency().
+	/// </summary>
+	/// <param name="receiver">receiver which will be tuned</param>
+	RDA5807_PresetBank(RDA5807& receiver) : m_receiver(receiver) { memset(m_presets, 0, sizeof(m_presets)); }
+
+	RDA5807_PresetBank(const RDA5807_PresetBank&) = delete;
+	RDA5807_PresetBank& operator=(const RDA5807_PresetBank&) = delete;
+
+	/// <summary>
+	/// Stores frequency in preset and prepares register value for current configuration of receiver.
+	/// </summary>
+	/// <param name="index">index of preset, from 0 to RDA5807_PRESET_COUNT - 1</param>
+	/// <param name="freq">frequency, ex: 919 is 91.9Mhz</param>
+	/// <param name="programmeIdentification">PI of station, 0 if it is unknown</param>
+	/// <returns>true if preset was stored, false if index is wrong or frequency is outside selected band</returns>
+	bool storePreset(const uint8_t& index, const uint16_t& freq, const uint16_t& programmeIdentification = 0);
+
+	/// <summary>
+	/// Loads preset, for example saved before in EEPROM. Register value is prepared again at recall if receiver configuration differs.
+	/// </summary>
+	/// <param name="index">index of preset, from 0 to RDA5807_PRESET_COUNT - 1</param>
+	/// <param name="data">preset to load</param>
+	/// <returns>true if preset was loaded, false if index is wrong</returns>
+	bool setPreset(const uint8_t& index, const preset& data);
+
+	/// <summary>
+	/// Clears preset.
+	/// </summary>
+	/// <param name="index">index of preset, from 0 to RDA5807_PRESET_COUNT - 1</param>
+	void clearPreset(const uint8_t& index) { if (index < RDA5807_PRESET_COUNT) m_presets[index] = { 0 }; }
+
+	/// <summary>
+	/// Starts change of frequency to preset. Register is written only if receiver doesn't receive this frequency already.
+	/// Use RDA5807::checkIfTuneIsComplete() to check when receiver is tuned.
+	/// </summary>
+	/// <param name="index">index of preset, from 0 to RDA5807_PRESET_COUNT - 1</param>
+	/// <returns>true if change was started, false if preset is empty or communication failed</returns>
+	bool recallPreset(const uint8_t& index);
+
+	/// <summary>
+	/// Saves PI confirmed by RDS decoder in preset. Call it when receiver is tuned to preset.
+	/// </summary>
+	/// <param name="index">index of preset, from 0 to RDA5807_PRESET_COUNT - 1</param>
+	/// <returns>true if PI was saved, false if it isn't confirmed yet</returns>
+	bool updateProgrammeIdentification(const uint8_t& index);
+
+	/// <summary>
+	/// Returns preset.
+	/// </summary>
+	/// <param name="index">index of preset, from 0 to RDA5807_PRESET_COUNT - 1</param>
+	/// <returns>preset, empty one if index is wrong</returns>
+	preset getPreset(const uint8_t& index) const;
+
+	/// <summary>
+	/// Finds preset with given PI.
+	/// </summary>
+	/// <param name="programmeIdentification">PI of station</param>
+	/// <returns>index of preset, 0xFF if it wasn't found</returns>
+	uint8_t findPreset(const uint16_t& programmeIdentification) const;
+
+	/// <summary>
+	/// Sets station database used as source of PS and PTY for presets, so they can be displayed right after recall, before RDS is received.
+	/// </summary>
+	/// <param name="database">station database, nullptr to disable</param>
+	void setStationDatabase(const RDA5807_StationDatabase* database) { m_database = database; }
+
+	/// <summary>
+	/// Reads data of preset station from station database. Station is found by PI, or by frequency if PI of preset is unknown.
+	/// </summary>
+	/// <param name="index">index of preset, from 0 to RDA5807_PRESET_COUNT - 1</param>
+	/// <param name="dest">destination for station data</param>
+	/// <returns>true if station was found, false otherwise</returns>
+	bool getPresetStation(const uint8_t& index, RDA5807_StationDatabase::station& dest) const;
+
+	/// <summary>
+	/// Returns statistics of recalls.
+	/// </summary>
+	/// <returns>preset statistics</returns>
+	const presetStats& getStats(void) const { return m_stats; }
+
+	/// <summary>
+	/// Clears statistics of recalls.
+	/// </summary>
+	void resetStats(void) { m_stats = { 0 }; }
+
+private:
+	/// <summary>
+	/// Returns current band, channel spacing and frequency setting mode of receiver packed in one value.
+	/// </summary>
+	/// <returns>configuration value</returns>
+	uint8_t getConfiguration(void);
+};
+
+#endif
@@ -0,0 +1,53 @@
+/*
+ Name:		RDA5807_Profile.cpp
+ Created:	19/10/2026 1:47:33 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "RDA5807_Profile.h"
+
+const uint16_t RDA5807_Profile::m_registerMasks[RDA5807_Profile::registerCount] =
+{
+	0xFEFC,//without power up, soft reset and seek bits
+	0x002F,//band, channel spacing and direct mode, without channel and tune bit
+	0xFFFF,
+	0xFFFF,
+	0xFFFF,
+	0xFFFF
+};
+
+RDA5807_Profile RDA5807_Profile::capture(const char* name, RDA5807& receiver)
+{
+	return RDA5807_Profile(name, receiver.getReg02(), receiver.getReg03(), receiver.getReg04(),
+		receiver.getReg05(), receiver.getReg06(), receiver.getReg07());
+}
+
+bool RDA5807_Profile::apply(RDA5807& receiver) const
+{
+	receiver.setReg02((receiver.getReg02() & ~m_registerMasks[0]) | getRegister(0));
+	receiver.setReg03((receiver.getReg03() & ~m_registerMasks[1]) | getRegister(1));
+	receiver.setReg04((receiver.getReg04() & ~m_registerMasks[2]) | getRegister(2));
+	receiver.setReg05((receiver.getReg05() & ~m_registerMasks[3]) | getRegister(3));
+	receiver.setReg06((receiver.getReg06() & ~m_registerMasks[4]) | getRegister(4));
+	receiver.setReg07((receiver.getReg07() & ~m_registerMasks[5]) | getRegister(5));
+	return receiver.writeModifiedRegistersInBurst();
+}
+
+uint8_t RDA5807_Profile::getSwitchSize(const RDA5807_Profile& from) const
+{
+	uint8_t separateSize = 0;
+	uint8_t last = 0;
+
+	for (uint8_t i = 0; i < registerCount; i++)
+	{//the same calculation as in RDA5807::writeModifiedRegistersInBurst()
+		if (getRegister(i) == from.getRegister(i)) continue;
+		separateSize += 4;//address, register number and two bytes of value
+		last = i + 1;
+	}
+	if (!last) return 0;
+
+	const uint8_t sequentialSize = 1 + (last * 2);//address and two bytes for each register
+	return (sequentialSize < separateSize) ? sequentialSize : separateSize;
+}
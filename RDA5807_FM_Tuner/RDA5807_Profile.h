@@ -0,0 +1,91 @@
+/*
+ Name:		RDA5807_Profile.h
+ Created:	19/10/2026 1:47:33 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _RDA5807_PROFILE_h
+#define _RDA5807_PROFILE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "RDA5807_FM_Tuner.h"
+
+class RDA5807_Profile final
+{
+public:
+	static const uint8_t registerCount = 6;//registers 0x02 to 0x07
+
+private:
+	/// <summary>
+	/// Bits of registers 0x02 to 0x07 which belong to profile. Power up, soft reset, seek, tune and channel bits are left unchanged by profile.
+	/// </summary>
+	static const uint16_t m_registerMasks[registerCount];
+
+	const char* const m_name;
+	const uint16_t m_registers[registerCount];
+
+public:
+	/// <summary>
+	/// Creates profile from register values, for example printed before by application from captured profile.
+	/// Profile can be created at compile time.
+	/// </summary>
+	/// <param name="name">name of profile, it has to exist as long as profile</param>
+	/// <param name="reg02">value of register 0x02</param>
+	/// <param name="reg03">value of register 0x03</param>
+	/// <param name="reg04">value of register 0x04</param>
+	/// <param name="reg05">value of register 0x05</param>
+	/// <param name="reg06">value of register 0x06</param>
+	/// <param name="reg07">value of register 0x07</param>
+	constexpr RDA5807_Profile(const char* name, const uint16_t& reg02, const uint16_t& reg03, const uint16_t& reg04,
+		const uint16_t& reg05, const uint16_t& reg06, const uint16_t& reg07)
+		: m_name(name), m_registers{ reg02, reg03, reg04, reg05, reg06, reg07 } {}
+
+	RDA5807_Profile& operator=(const RDA5807_Profile&) = delete;
+
+	/// <summary>
+	/// Creates profile from settings stored locally in receiver. Set them with setXxx() methods before, they don't have to be written to receiver.
+	/// </summary>
+	/// <param name="name">name of profile, it has to exist as long as profile</param>
+	/// <param name="receiver">source of settings</param>
+	/// <returns>captured profile</returns>
+	static RDA5807_Profile capture(const char* name, RDA5807& receiver);
+
+	/// <summary>
+	/// Switches receiver to this profile. Bits of profile are copied to locally stored registers,
+	/// then only modified registers are written with one sequential write or separate writes, whichever needs fewer bytes.
+	/// Frequency and power state of receiver are kept.
+	/// </summary>
+	/// <param name="receiver">receiver to configure</param>
+	/// <returns>true if all modified registers were written, false otherwise</returns>
+	bool apply(RDA5807& receiver) const;
+
+	/// <summary>
+	/// Returns number of bytes, including address bytes, needed to switch receiver from given profile to this one.
+	/// Can be used to compare profiles without receiver.
+	/// </summary>
+	/// <param name="from">profile which is currently applied</param>
+	/// <returns>number of bytes, 0 if profiles have the same settings</returns>
+	uint8_t getSwitchSize(const RDA5807_Profile& from) const;
+
+	/// <summary>
+	/// Returns name of profile.
+	/// </summary>
+	/// <returns>name of profile</returns>
+	const char* getName(void) const { return m_name; }
+
+	/// <summary>
+	/// Returns value of register stored in profile, only bits which belong to profile are set.
+	/// </summary>
+	/// <param name="index">index of register, 0 is register 0x02</param>
+	/// <returns>value of register, 0 if index is wrong</returns>
+	uint16_t getRegister(const uint8_t& index) const { return (index < registerCount) ? (m_registers[index] & m_registerMasks[index]) : 0; }
+};
+
+#endif
@@ -0,0 +1,136 @@
+/*
+ Name:		RDA5807_RdsPoller.cpp
+ Created:	19/10/2026 7:03:26 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "RDA5807_RdsPoller.h"
+
+bool RDA5807_RdsPoller::update(void)
+{
+	const unsigned long now = micros();
+
+	if ((now - m_nextPoll) > 0x7FFFFFFFUL) return false;//planned time is in the future
+
+	if (m_synchronized)
+	{//groups should come all the time since previous poll
+		m_synchronizedTime += now - m_lastPoll;
+		while (m_synchronizedTime >= m_period)
+		{
+			m_synchronizedTime -= m_period;
+			m_expectedGroups++;
+		}
+	}
+
+	const bool ready = m_receiver.checkIfNewRdsDataIsReady();
+	m_stats.polls++;
+	if (ready && m_receiver.updateRdsData())
+	{
+		m_receiver.updateDecodedRdsData();
+		m_synchronized = true;
+		addGroup(now);
+		m_stats.lostGroups = (m_expectedGroups > m_stats.groups) ? (m_expectedGroups - m_stats.groups) : 0;
+		m_lastPollEmpty = false;
+		m_lastPoll = now;
+		return true;
+	}
+
+	if (ready || m_receiver.getRdsGroupState()) m_nextPoll = now + (m_settings.retryInterval * 1000UL);//communication failed, group is still waiting
+	else if (!m_receiver.getRdsSynchronizationState())
+	{//no group will come soon, so bus time isn't wasted
+		if (m_synchronized) m_stats.synchronizationLosses++;
+		m_synchronized = false;
+		m_anchorValid = false;
+		m_calibrationValid = false;
+		m_nextPoll = now + (((m_settings.mode == pollingMode::fixed) ? m_settings.fixedInterval : m_settings.lostSyncInterval) * 1000UL);
+	}
+	else
+	{
+		m_synchronized = true;
+		planRetry(now);
+	}
+	m_lastPollEmpty = true;
+	m_lastPoll = now;
+	return false;
+}
+
+void RDA5807_RdsPoller::resetStats(void)
+{
+	m_stats = { 0 };
+	m_expectedGroups = 0;
+	m_synchronizedTime = 0;
+}
+
+void RDA5807_RdsPoller::reset(void)
+{
+	m_anchorValid = false;
+	m_calibrationValid = false;
+	m_lastPollEmpty = false;
+	m_synchronized = false;
+	m_nextPoll = micros();
+}
+
+void RDA5807_RdsPoller::addGroup(const unsigned long& now)
+{
+	const bool bracketed = m_lastPollEmpty && (now - m_lastPoll) <= (m_settings.retryInterval * 2000UL);//previous poll found nothing just before
+	const unsigned long arrival = bracketed ? (now - ((now - m_lastPoll) / 2)) : now;
+	uint32_t periods = 1;
+
+	m_stats.groups++;
+	if (m_anchorValid)
+	{
+		periods = (arrival - m_anchor + (m_period / 2)) / m_period;
+		if (!periods) periods = 1;
+	}
+
+	if (bracketed)
+	{
+		if (m_calibrationValid)
+		{//time between two measured arrivals gives period without error of late polls
+			const uint32_t count = (arrival - m_calibrationAnchor + (m_period / 2)) / m_period;
+			if (count)
+			{
+				const int32_t difference = static_cast<int32_t>((arrival - m_calibrationAnchor) / count) - static_cast<int32_t>(m_period);
+				if (difference < static_cast<int32_t>(m_period / 16) && difference > -static_cast<int32_t>(m_period / 16)) m_period += difference / 4;
+			}
+		}
+		m_calibrationAnchor = arrival;
+		m_calibrationValid = true;
+		m_anchor = arrival;
+		m_groupsSinceCalibration = 0;
+	}
+	else
+	{//group came before this poll, so predicted arrival can't be later than now
+		const unsigned long predicted = m_anchor + (periods * m_period);
+		const bool usePrediction = m_anchorValid && m_settings.mode == pollingMode::adaptive && (now - predicted) <= 0x7FFFFFFFUL;
+		m_anchor = usePrediction ? predicted : now;
+		if (m_groupsSinceCalibration < 0xFF) m_groupsSinceCalibration++;
+	}
+	m_anchorValid = true;
+
+	if (m_settings.mode == pollingMode::fixed) m_nextPoll = now + (m_settings.fixedInterval * 1000UL);
+	else if (!m_calibrationValid || m_groupsSinceCalibration >= m_settings.calibrationGroups)
+		m_nextPoll = m_anchor + m_period - (m_settings.guardTime * 1000UL);//poll before group comes to measure its arrival
+	else m_nextPoll = m_anchor + m_period + (m_settings.guardTime * 1000UL);
+}
+
+void RDA5807_RdsPoller::planRetry(const unsigned long& now)
+{
+	if (m_settings.mode == pollingMode::fixed)
+	{
+		m_nextPoll = now + (m_settings.fixedInterval * 1000UL);
+		return;
+	}
+	if (!m_anchorValid)
+	{//synchronization is being regained, group can come at any moment
+		m_nextPoll = now + (m_settings.retryInterval * 1000UL);
+		return;
+	}
+
+	const uint32_t periods = (now - m_anchor) / m_period;
+	const unsigned long expected = m_anchor + (periods * m_period);
+	if (!periods || (now - expected) <= (m_period / 4)) m_nextPoll = now + (m_settings.retryInterval * 1000UL);//group is expected now
+	else m_nextPoll = expected + m_period - (m_settings.guardTime * 1000UL);//group was lost, wait for next one and measure its arrival
+}
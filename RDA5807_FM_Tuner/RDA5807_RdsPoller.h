@@ -0,0 +1,161 @@
+/*
+ Name:		RDA5807_RdsPoller.h
+ Created:	19/10/2026 7:03:26 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _RDA5807_RDSPOLLER_h
+#define _RDA5807_RDSPOLLER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "RDA5807_FM_Tuner.h"
+
+class RDA5807_RdsPoller final
+{
+public:
+	/// <summary>
+	/// Possible ways of polling receiver for new RDS group.
+	/// </summary>
+	enum class pollingMode : uint8_t { fixed, adaptive };
+
+	/// <summary>
+	/// Statistics of polling.
+	/// </summary>
+	struct pollerStats
+	{
+		uint32_t polls;//number of checks if new group is ready, one I2C transaction each
+		uint32_t groups;//number of received groups
+		uint32_t lostGroups;//number of groups which were replaced by next one before they were read, estimated from time with RDS synchronization
+		uint16_t synchronizationLosses;//number of times RDS synchronization was lost
+	};
+
+private:
+	RDA5807& m_receiver;
+
+	/// <summary>
+	/// Settings of polling.
+	/// </summary>
+	struct
+	{
+		pollingMode mode = pollingMode::adaptive;
+		uint16_t fixedInterval = 40;//time in ms between polls in fixed mode
+		uint16_t retryInterval = 3;//time in ms between polls when group is expected or synchronization is being regained
+		uint16_t lostSyncInterval = 250;//time in ms between polls when there is no RDS synchronization
+		uint16_t guardTime = 2;//time in ms between expected group arrival and poll
+		uint8_t calibrationGroups = 8;//number of groups after which arrival time is measured again
+	} m_settings;
+
+	uint32_t m_period = 87600;//learned time in us between groups, nominal value is 104 bits / 1187.5 bit/s
+	unsigned long m_nextPoll = 0;//time in us
+	unsigned long m_lastPoll = 0;//time in us
+	unsigned long m_anchor = 0;//estimated arrival time in us of last received group
+	unsigned long m_calibrationAnchor = 0;//measured arrival time in us of group used to learn period
+	uint32_t m_synchronizedTime = 0;//time in us with RDS synchronization, not yet counted in m_expectedGroups
+	uint32_t m_expectedGroups = 0;//number of groups which should be received since statistics were reset
+	uint8_t m_groupsSinceCalibration = 0;
+	bool m_anchorValid = false;
+	bool m_calibrationValid = false;
+	bool m_lastPollEmpty = false;
+	bool m_synchronized = false;
+	pollerStats m_stats = { 0 };
+
+public:
+	/// <summary>
+	/// Creates RDS poller. In adaptive mode it learns time between RDS groups and checks receiver just after next group is expected,
+	/// polls rarely when there is no RDS synchronization and often while synchronization is being regained.
+	/// In fixed mode receiver is checked with constant interval. RDS decoder has to be enabled in receiver.
+	/// </summary>
+	/// <param name="receiver">receiver with enabled RDS</param>
+	RDA5807_RdsPoller(RDA5807& receiver) : m_receiver(receiver) {}
+
+	RDA5807_RdsPoller(const RDA5807_RdsPoller&) = delete;
+	RDA5807_RdsPoller& operator=(const RDA5807_RdsPoller&) = delete;
+
+	/// <summary>
+	/// Checks if new group is ready when its time has come and decodes it. Call it as often as possible, for example in main loop.
+	/// </summary>
+	/// <returns>true if new group was decoded, false otherwise</returns>
+	bool update(void);
+
+	/// <summary>
+	/// Forgets arrival time of last group, call it after frequency change. Learned time between groups is kept.
+	/// </summary>
+	void reset(void);
+
+	/// <summary>
+	/// Sets way of polling.
+	/// </summary>
+	/// <param name="mode">polling mode</param>
+	/// <param name="fixedInterval">time in ms between polls in fixed mode</param>
+	void setMode(const pollingMode& mode, const uint16_t& fixedInterval = 40)
+	{
+		m_settings.mode = mode;
+		m_settings.fixedInterval = fixedInterval;
+	}
+
+	/// <summary>
+	/// Sets timing of adaptive polling.
+	/// </summary>
+	/// <param name="retryInterval">time in ms between polls when group is expected or synchronization is being regained</param>
+	/// <param name="lostSyncInterval">time in ms between polls when there is no RDS synchronization</param>
+	/// <param name="guardTime">time in ms between expected group arrival and poll</param>
+	/// <param name="calibrationGroups">number of groups after which arrival time is measured again, from 1 to 255</param>
+	void setAdaptiveTiming(const uint16_t& retryInterval, const uint16_t& lostSyncInterval = 250, const uint16_t& guardTime = 2, const uint8_t& calibrationGroups = 8)
+	{
+		m_settings.retryInterval = retryInterval ? retryInterval : 1;
+		m_settings.lostSyncInterval = lostSyncInterval;
+		m_settings.guardTime = guardTime;
+		m_settings.calibrationGroups = calibrationGroups ? calibrationGroups : 1;
+	}
+
+	/// <summary>
+	/// Returns learned time between groups.
+	/// </summary>
+	/// <returns>time in us</returns>
+	uint32_t getGroupPeriod(void) const { return m_period; }
+
+	/// <summary>
+	/// Returns number of polls needed to receive one group.
+	/// </summary>
+	/// <returns>polls per group, 0 if no group was received</returns>
+	float getPollsPerGroup(void) const { return m_stats.groups ? static_cast<float>(m_stats.polls) / m_stats.groups : 0; }
+
+	/// <summary>
+	/// Returns percent of groups which were lost.
+	/// </summary>
+	/// <returns>percent of lost groups</returns>
+	float getGroupLossRate(void) const { return (m_stats.groups + m_stats.lostGroups) ? (m_stats.lostGroups * 100.0f) / (m_stats.groups + m_stats.lostGroups) : 0; }
+
+	/// <summary>
+	/// Returns statistics of polling.
+	/// </summary>
+	/// <returns>poller statistics</returns>
+	const pollerStats& getStats(void) const { return m_stats; }
+
+	/// <summary>
+	/// Clears statistics of polling.
+	/// </summary>
+	void resetStats(void);
+
+private:
+	/// <summary>
+	/// Updates arrival time and learned period using group received now.
+	/// </summary>
+	/// <param name="now">time in us of poll which found group</param>
+	void addGroup(const unsigned long& now);
+
+	/// <summary>
+	/// Plans next poll when group wasn't ready.
+	/// </summary>
+	/// <param name="now">time in us of poll</param>
+	void planRetry(const unsigned long& now);
+};
+
+#endif
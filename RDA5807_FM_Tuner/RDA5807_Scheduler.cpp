@@ -0,0 +1,100 @@
+/*
+ Name:		RDA5807_Scheduler.cpp
+ Created:	19/10/2026 5:18:44 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "RDA5807_Scheduler.h"
+
+uint8_t RDA5807_Scheduler::addTask(taskFunction function, void* context, const uint16_t& interval, const uint16_t& offset)
+{
+	const uint8_t index = findFreeSlot();
+
+	if (function == nullptr || index == 0xFF) return 0xFF;
+	m_tasks[index] = { 0 };
+	m_tasks[index].function = function;
+	m_tasks[index].context = context;
+	m_tasks[index].interval = interval;
+	m_tasks[index].nextRun = millis() + offset;
+	m_tasks[index].enabled = true;
+	return index;
+}
+
+uint8_t RDA5807_Scheduler::addOneShotTask(taskFunction function, void* context, const uint16_t& delay)
+{
+	const uint8_t index = addTask(function, context, 0, delay);
+
+	if (index != 0xFF) m_tasks[index].oneShot = true;
+	return index;
+}
+
+void RDA5807_Scheduler::setTaskEnabled(const uint8_t& index, const bool& setting)
+{
+	if (index >= RDA5807_SCHEDULER_TASK_COUNT) return;
+	if (setting && !m_tasks[index].enabled) m_tasks[index].nextRun = millis() + m_tasks[index].interval;
+	m_tasks[index].enabled = setting;
+}
+
+bool RDA5807_Scheduler::update(void)
+{
+	const unsigned long start = micros();
+	const unsigned long now = millis();
+	uint8_t selected = 0xFF;
+	unsigned long maxLateness = 0;
+
+	for (uint8_t i = 0; i < RDA5807_SCHEDULER_TASK_COUNT; i++)
+	{
+		if (m_tasks[i].function == nullptr || !m_tasks[i].enabled) continue;
+
+		const unsigned long lateness = now - m_tasks[i].nextRun;
+		if (lateness > 0x7FFFFFFFUL) continue;//planned time is in the future
+		if (selected == 0xFF || lateness > maxLateness)
+		{
+			selected = i;
+			maxLateness = lateness;
+		}
+	}
+	if (selected == 0xFF) return false;
+
+	task& current = m_tasks[selected];
+	const taskFunction function = current.function;
+	if (maxLateness > current.stats.maxLateness) current.stats.maxLateness = (maxLateness > 0xFFFF) ? 0xFFFF : static_cast<uint16_t>(maxLateness);
+	if (current.oneShot) current.function = nullptr;//slot is freed before run, so task can add itself again
+	else if (!current.interval) current.nextRun = now;
+	else
+	{
+		if (maxLateness >= current.interval)
+		{//at least one run was missed, it isn't repeated to catch up
+			current.stats.overruns++;
+			current.nextRun = now;
+		}
+		current.nextRun += current.interval;//planned from previous planned time, so runs don't drift
+	}
+
+	const unsigned long taskStart = micros();
+	function(current.context);
+	const unsigned long taskTime = micros() - taskStart;
+
+	current.stats.runs++;
+	current.stats.totalTime += taskTime;
+	if (taskTime > current.stats.maxTime) current.stats.maxTime = taskTime;
+
+	const unsigned long updateTime = micros() - start;
+	if (updateTime > m_maxUpdateTime) m_maxUpdateTime = updateTime;
+	return true;
+}
+
+void RDA5807_Scheduler::resetStats(void)
+{
+	for (uint8_t i = 0; i < RDA5807_SCHEDULER_TASK_COUNT; i++) m_tasks[i].stats = { 0 };
+	m_maxUpdateTime = 0;
+}
+
+uint8_t RDA5807_Scheduler::findFreeSlot(void) const
+{
+	for (uint8_t i = 0; i < RDA5807_SCHEDULER_TASK_COUNT; i++)
+		if (m_tasks[i].function == nullptr) return i;
+	return 0xFF;
+}
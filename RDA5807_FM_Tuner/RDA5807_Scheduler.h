@@ -0,0 +1,142 @@
+/*
+ Name:		RDA5807_Scheduler.h
+ Created:	19/10/2026 5:18:44 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _RDA5807_SCHEDULER_h
+#define _RDA5807_SCHEDULER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#ifndef RDA5807_SCHEDULER_TASK_COUNT
+#define RDA5807_SCHEDULER_TASK_COUNT 8//max number of tasks
+#endif
+
+class RDA5807_Scheduler final
+{
+public:
+	/// <summary>
+	/// Function called when task is run. It should do a short piece of work and return, like update() methods of other modules.
+	/// </summary>
+	/// <param name="context">pointer passed when task was added</param>
+	typedef void(*taskFunction)(void* context);
+
+	/// <summary>
+	/// Statistics of task.
+	/// </summary>
+	struct taskStats
+	{
+		uint32_t runs;//number of runs
+		uint16_t overruns;//number of runs which started later than one interval after planned time, missed runs are skipped
+		uint32_t totalTime;//time in us of all runs
+		uint32_t maxTime;//max time in us of one run
+		uint16_t maxLateness;//max time in ms between planned and real start of run
+	};
+
+private:
+	/// <summary>
+	/// Task in task table.
+	/// </summary>
+	struct task
+	{
+		taskFunction function;//nullptr if slot is free
+		void* context;
+		uint16_t interval;//time in ms between runs
+		unsigned long nextRun;
+		bool oneShot;
+		bool enabled;
+		taskStats stats;
+	};
+
+	task m_tasks[RDA5807_SCHEDULER_TASK_COUNT];
+	uint32_t m_maxUpdateTime = 0;//max time in us of one update() call
+
+public:
+	/// <summary>
+	/// Creates cooperative scheduler with fixed number of tasks, set by RDA5807_SCHEDULER_TASK_COUNT. No memory is allocated.
+	/// Only one task is run per update() call, so tasks planned for the same time are spread over following calls.
+	/// </summary>
+	RDA5807_Scheduler(void) { memset(m_tasks, 0, sizeof(m_tasks)); }
+
+	RDA5807_Scheduler(const RDA5807_Scheduler&) = delete;
+	RDA5807_Scheduler& operator=(const RDA5807_Scheduler&) = delete;
+
+	/// <summary>
+	/// Adds task run periodically. Use different offsets for tasks with the same interval to spread their I2C transactions in time.
+	/// </summary>
+	/// <param name="function">function of task</param>
+	/// <param name="context">pointer passed to function, for example object which has to be updated</param>
+	/// <param name="interval">time in ms between runs, 0 to run task as often as possible, taking turns with other due tasks</param>
+	/// <param name="offset">time in ms from now to first run</param>
+	/// <returns>index of task, 0xFF if task table is full</returns>
+	uint8_t addTask(taskFunction function, void* context, const uint16_t& interval, const uint16_t& offset = 0);
+
+	/// <summary>
+	/// Adds task run once. Its slot is freed when it is run.
+	/// </summary>
+	/// <param name="function">function of task</param>
+	/// <param name="context">pointer passed to function</param>
+	/// <param name="delay">time in ms from now to run</param>
+	/// <returns>index of task, 0xFF if task table is full</returns>
+	uint8_t addOneShotTask(taskFunction function, void* context, const uint16_t& delay);
+
+	/// <summary>
+	/// Removes task and frees its slot.
+	/// </summary>
+	/// <param name="index">index of task</param>
+	void removeTask(const uint8_t& index) { if (index < RDA5807_SCHEDULER_TASK_COUNT) m_tasks[index].function = nullptr; }
+
+	/// <summary>
+	/// Enables or disables task. Enabled task is run first time after one interval.
+	/// </summary>
+	/// <param name="index">index of task</param>
+	/// <param name="setting">true to enable, false to disable</param>
+	void setTaskEnabled(const uint8_t& index, const bool& setting = true);
+
+	/// <summary>
+	/// Changes interval of periodic task. New interval is used after next run.
+	/// </summary>
+	/// <param name="index">index of task</param>
+	/// <param name="interval">time in ms between runs</param>
+	void setTaskInterval(const uint8_t& index, const uint16_t& interval) { if (index < RDA5807_SCHEDULER_TASK_COUNT) m_tasks[index].interval = interval; }
+
+	/// <summary>
+	/// Runs task which waits the longest since its planned time, if there is any. Call it as often as possible, for example in main loop.
+	/// </summary>
+	/// <returns>true if task was run, false otherwise</returns>
+	bool update(void);
+
+	/// <summary>
+	/// Returns statistics of task.
+	/// </summary>
+	/// <param name="index">index of task</param>
+	/// <returns>task statistics</returns>
+	const taskStats& getTaskStats(const uint8_t& index) const { return m_tasks[(index < RDA5807_SCHEDULER_TASK_COUNT) ? index : 0].stats; }
+
+	/// <summary>
+	/// Returns max time of one update() call, which is the longest delay scheduler added to main loop.
+	/// </summary>
+	/// <returns>time in us</returns>
+	uint32_t getMaxUpdateTime(void) const { return m_maxUpdateTime; }
+
+	/// <summary>
+	/// Clears statistics of all tasks.
+	/// </summary>
+	void resetStats(void);
+
+private:
+	/// <summary>
+	/// Finds free slot in task table.
+	/// </summary>
+	/// <returns>index of slot, 0xFF if task table is full</returns>
+	uint8_t findFreeSlot(void) const;
+};
+
+#endif
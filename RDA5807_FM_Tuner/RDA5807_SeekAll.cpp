@@ -0,0 +1,175 @@
+/*
+ Name:		RDA5807_SeekAll.cpp
+ Created:	18/10/2026 10:31:40 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "RDA5807_SeekAll.h"
+#include "RDA5807_Utilities.h"
+
+bool RDA5807_SeekAll::begin(seekStop* stops, const uint8_t& size)
+{
+	uint16_t first = 0;
+	uint16_t last = 0;
+
+	if (stops == nullptr || !size || m_receiver.getAlternativeFrequencySettingMode()) return false;//hardware seek works only in standard mode
+
+	if (m_state == state::disabled)
+	{
+		m_wasMuted = m_receiver.getMute();
+		m_wasSeekUp = m_receiver.getSeekUp();
+		m_wasStopAtBandLimit = m_receiver.getSeekModeStopAtBandLimit();
+		m_wasInterruptEnabled = m_receiver.getSeekTuneCompleteInterrupt();
+		m_wasGpio2 = m_receiver.getGpio2();
+	}
+	m_receiver.setMute(true);
+	m_receiver.setSeekUp(true);
+	m_receiver.setSeekModeStopAtBandLimit(true);
+	m_receiver.setSeekTuneCompleteInterrupt(m_interruptMode);
+	m_receiver.setGpio2(m_interruptMode ? RDA5807::gpio2Status::interrupt : m_wasGpio2);//interrupt pulse is generated only on GPIO2 in interrupt mode
+	m_receiver.setSeek(false);
+	if (!m_receiver.writeSettingsToReceiver()) return false;//seek settings are in many registers
+
+	RDA5807_Utilities::getBandLimits(first, last, m_receiver.getBand(), !m_receiver.get65mMode());
+	m_stats = { 0 };
+	m_stats.bandChannels = (((last - first) * 100) / RDA5807_Utilities::getChannelSpacingValue(m_receiver.getChannelSpacing())) + 1;
+	m_stops = stops;
+	m_stopsSize = size;
+	m_stopCount = 0;
+	m_lastChannel = 0;//channel from previous sweep would end this one at once
+	m_start = millis();
+	m_stateStart = millis();
+	m_state = state::tuning;
+	if (!m_receiver.startFrequencyChange(first)) startSeek();//first channel won't be checked
+	return true;
+}
+
+void RDA5807_SeekAll::end(void)
+{
+	if (m_state == state::disabled) return;
+
+	m_receiver.setMute(m_wasMuted);
+	m_receiver.setSeekUp(m_wasSeekUp);
+	m_receiver.setSeekModeStopAtBandLimit(m_wasStopAtBandLimit);
+	m_receiver.setSeekTuneCompleteInterrupt(m_wasInterruptEnabled);
+	m_receiver.setGpio2(m_wasGpio2);
+	m_receiver.setSeek(false);
+	m_receiver.writeSettingsToReceiver();
+	m_stops = nullptr;
+	m_state = state::disabled;
+}
+
+bool RDA5807_SeekAll::update(void)
+{
+	switch (m_state)
+	{
+	case state::tuning:
+		if ((millis() - m_stateStart) < m_settings.pollInterval) return false;
+		m_stats.polls++;
+		if (!m_receiver.checkIfTuneIsComplete() && ((millis() - m_stateStart) <= m_settings.seekTimeout)) return false;
+		m_lastChannel = m_receiver.getCurrentFrequency();
+		m_samples = 0;
+		m_stateStart = millis();
+		m_state = state::verifying;//first channel of band is checked the same way as stops
+		return false;
+
+	case state::seeking:
+		updateSeeking();
+		return m_state == state::complete;
+
+	case state::verifying:
+		updateVerification();
+		return m_state == state::complete;
+
+	default:
+		return false;
+	}
+}
+
+void RDA5807_SeekAll::startSeek(void)
+{
+	m_seekTuneComplete = false;
+	if (m_receiver.updateSeek()) m_stats.seeks++;//if it failed, it will be repeated after timeout
+	m_receiver.setSeek(false);//chip clears it by itself, without that next write of register 0x02 would start another seek
+	m_stateStart = millis();
+	m_lastPoll = millis();
+	m_state = state::seeking;
+}
+
+void RDA5807_SeekAll::updateSeeking(void)
+{
+	const unsigned long time = millis() - m_stateStart;
+	const bool timeout = time > m_settings.seekTimeout;
+
+	if (!timeout)
+	{
+		if (m_interruptMode ? !m_seekTuneComplete : ((millis() - m_lastPoll) < m_settings.pollInterval)) return;
+		m_seekTuneComplete = false;
+		m_lastPoll = millis();
+	}
+	m_stats.polls++;
+	if (!m_receiver.checkIfTuneIsComplete())
+	{
+		if (timeout) startSeek();//seek wasn't started or interrupt was missed
+		return;
+	}
+	m_stats.seekTime += time;
+
+	const uint16_t channel = m_receiver.getCurrentFrequency();
+	if (m_receiver.getSeekFail() || channel <= m_lastChannel)
+	{//band limit reached
+		complete();
+		return;
+	}
+
+	m_lastChannel = channel;
+	m_samples = 0;
+	m_stateStart = millis();
+	m_state = state::verifying;
+}
+
+void RDA5807_SeekAll::updateVerification(void)
+{
+	if ((millis() - m_stateStart) < m_settings.verifyInterval) return;
+	m_stateStart = millis();
+	m_stats.polls++;
+	if (!m_receiver.updateStatusRegisters()) return;
+
+	if (!m_samples)
+	{
+		m_candidate.frequency = convertChannelToFrequency(m_receiver.getCurrentFrequency());
+		m_candidate.rssi = m_receiver.getRssi();
+		m_candidate.stereo = false;
+	}
+	if (m_receiver.getRssi() < m_candidate.rssi) m_candidate.rssi = m_receiver.getRssi();
+	if (m_receiver.getStereoIndicator()) m_candidate.stereo = true;
+	if (++m_samples < m_settings.verifySamples && m_candidate.rssi >= m_settings.minRssi) return;
+
+	if (m_candidate.rssi >= m_settings.minRssi && (m_candidate.stereo || !m_settings.requireStereo))
+	{
+		m_stops[m_stopCount++] = m_candidate;
+		if (m_stopCount >= m_stopsSize)
+		{
+			complete();
+			return;
+		}
+	}
+	else if (m_stats.seeks) m_stats.falseStops++;//first channel of band isn't a seek stop
+
+	startSeek();
+}
+
+void RDA5807_SeekAll::complete(void)
+{
+	m_stats.totalTime = millis() - m_start;
+	m_state = state::complete;
+}
+
+uint16_t RDA5807_SeekAll::convertChannelToFrequency(const uint16_t& channel)
+{
+	const float freq = RDA5807_Utilities::getFrequencyValue(channel, m_receiver.getChannelSpacing(), m_receiver.getBand(), !m_receiver.get65mMode());
+
+	return static_cast<uint16_t>((freq * 10) + 0.5f);
+}
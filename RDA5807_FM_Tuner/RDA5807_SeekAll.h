@@ -0,0 +1,202 @@
+/*
+ Name:		RDA5807_SeekAll.h
+ Created:	18/10/2026 10:31:40 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _RDA5807_SEEKALL_h
+#define _RDA5807_SEEKALL_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "RDA5807_FM_Tuner.h"
+
+class RDA5807_SeekAll final
+{
+public:
+	/// <summary>
+	/// Station found by seek.
+	/// </summary>
+	struct seekStop
+	{
+		uint16_t frequency;//ex: 919 is 91.9Mhz
+		uint8_t rssi;//the lowest RSSI measured during verification
+		bool stereo;//true if stereo was indicated during verification
+	};
+
+	/// <summary>
+	/// Statistics of last seek through the band.
+	/// </summary>
+	struct seekAllStats
+	{
+		uint16_t seeks;//number of started hardware seeks
+		uint16_t falseStops;//number of stops rejected by verification
+		uint16_t polls;//number of reads of status registers
+		uint32_t seekTime;//time in ms spent waiting for hardware seeks
+		uint32_t totalTime;//time in ms of whole seek through the band
+		uint16_t bandChannels;//number of channels in band with selected spacing, stepped scan would have to visit all of them
+	};
+
+private:
+	/// <summary>
+	/// Possible states of seek through the band.
+	/// </summary>
+	enum class state : uint8_t { disabled, tuning, seeking, verifying, complete };
+
+	RDA5807& m_receiver;
+	state m_state = state::disabled;
+
+	/// <summary>
+	/// Settings of seek through the band.
+	/// </summary>
+	struct
+	{
+		uint8_t minRssi = 20;//RSSI below which stop is rejected
+		bool requireStereo = false;//true if stop without stereo is rejected
+		uint8_t verifySamples = 3;//number of status reads during verification of stop
+		uint16_t verifyInterval = 10;//time in ms between status reads during verification
+		uint16_t pollInterval = 5;//time in ms between status reads during seek
+		uint16_t seekTimeout = 5000;//max time in ms of one hardware seek
+	} m_settings;
+
+	seekStop* m_stops = nullptr;
+	uint8_t m_stopsSize = 0;
+	uint8_t m_stopCount = 0;
+	uint16_t m_lastChannel = 0;
+	uint8_t m_samples = 0;
+	seekStop m_candidate = { 0 };
+	bool m_wasMuted = false;
+	bool m_wasSeekUp = false;
+	bool m_wasStopAtBandLimit = false;
+	bool m_wasInterruptEnabled = false;
+	RDA5807::gpio2Status m_wasGpio2 = RDA5807::gpio2Status::highImpedance;
+	volatile bool m_seekTuneComplete = false;//set from interrupt handler
+	bool m_interruptMode = false;
+	unsigned long m_stateStart = 0;
+	unsigned long m_lastPoll = 0;
+	unsigned long m_start = 0;
+	seekAllStats m_stats = { 0 };
+
+public:
+	/// <summary>
+	/// Creates engine which finds all stations in band by chaining hardware seeks. Seek thresholds set in receiver
+	/// (setSeekSnrThreshold(), setRssiSeekMode(), setOldSeekSnrThreshold()) are used. Standard frequency setting mode has to be selected.
+	/// </summary>
+	/// <param name="receiver">receiver which will be retuned</param>
+	RDA5807_SeekAll(RDA5807& receiver) : m_receiver(receiver) {}
+
+	RDA5807_SeekAll(const RDA5807_SeekAll&) = delete;
+	RDA5807_SeekAll& operator=(const RDA5807_SeekAll&) = delete;
+
+	/// <summary>
+	/// Starts seek from the beginning to the end of selected band. Audio is muted until seek is ended.
+	/// </summary>
+	/// <param name="stops">array for found stations, it has to exist until seek is completed</param>
+	/// <param name="size">size of array, seek is completed when it is full</param>
+	/// <returns>true if seek was started, false if alternative frequency setting mode is enabled or settings couldn't be written</returns>
+	bool begin(seekStop* stops, const uint8_t& size);
+
+	/// <summary>
+	/// Stops seek, restores seek settings and mute state. Tune receiver to desired frequency after that.
+	/// </summary>
+	void end(void);
+
+	/// <summary>
+	/// Performs next step of seek. It never waits for receiver, so call it as often as possible, for example in main loop.
+	/// </summary>
+	/// <returns>true if seek through the band was completed during this call, false otherwise</returns>
+	bool update(void);
+
+	/// <summary>
+	/// Sets verification of stops, which rejects stops on noise or on weak stations.
+	/// </summary>
+	/// <param name="minRssi">RSSI below which stop is rejected</param>
+	/// <param name="requireStereo">true if stop without stereo has to be rejected</param>
+	/// <param name="verifySamples">number of status reads, all of them need RSSI above minRssi</param>
+	/// <param name="verifyInterval">time in ms between status reads</param>
+	void setVerification(const uint8_t& minRssi, const bool& requireStereo = false, const uint8_t& verifySamples = 3, const uint16_t& verifyInterval = 10)
+	{
+		m_settings.minRssi = minRssi;
+		m_settings.requireStereo = requireStereo;
+		m_settings.verifySamples = verifySamples ? verifySamples : 1;
+		m_settings.verifyInterval = verifyInterval;
+	}
+
+	/// <summary>
+	/// Sets how often receiver is checked for end of seek.
+	/// </summary>
+	/// <param name="pollInterval">time in ms between status reads</param>
+	/// <param name="seekTimeout">max time in ms of one hardware seek</param>
+	void setPolling(const uint16_t& pollInterval, const uint16_t& seekTimeout = 5000)
+	{
+		m_settings.pollInterval = pollInterval;
+		m_settings.seekTimeout = seekTimeout;
+	}
+
+	/// <summary>
+	/// Enables interrupt mode. Receiver generates low pulse on GPIO2 when seek ends and status is read only
+	/// after notifySeekTuneComplete() is called from interrupt handler, or after seek timeout.
+	/// Takes effect when next seek through the band is started.
+	/// </summary>
+	/// <param name="setting">true to wait for interrupt, false to poll receiver</param>
+	void setInterruptMode(const bool& setting = true) { m_interruptMode = setting; }
+
+	/// <summary>
+	/// Informs engine that receiver generated seek/tune complete interrupt. Can be called from interrupt handler.
+	/// </summary>
+	void notifySeekTuneComplete(void) { m_seekTuneComplete = true; }
+
+	/// <summary>
+	/// Returns information if seek through the band was completed.
+	/// </summary>
+	/// <returns>true if seek is completed, false otherwise</returns>
+	bool getComplete(void) const { return m_state == state::complete; }
+
+	/// <summary>
+	/// Returns number of found stations.
+	/// </summary>
+	/// <returns>number of stations</returns>
+	uint8_t getStopCount(void) const { return m_stopCount; }
+
+	/// <summary>
+	/// Returns statistics of last seek through the band.
+	/// </summary>
+	/// <returns>seek statistics</returns>
+	const seekAllStats& getStats(void) const { return m_stats; }
+
+private:
+	/// <summary>
+	/// Starts next hardware seek up from currently received frequency.
+	/// </summary>
+	void startSeek(void);
+
+	/// <summary>
+	/// Waits for end of hardware seek.
+	/// </summary>
+	void updateSeeking(void);
+
+	/// <summary>
+	/// Reads status of found stop and decides if it is a station.
+	/// </summary>
+	void updateVerification(void);
+
+	/// <summary>
+	/// Marks seek as completed.
+	/// </summary>
+	void complete(void);
+
+	/// <summary>
+	/// Converts channel read from receiver to frequency.
+	/// </summary>
+	/// <param name="channel">channel value</param>
+	/// <returns>frequency value, ex: 919 is 91.9Mhz</returns>
+	uint16_t convertChannelToFrequency(const uint16_t& channel);
+};
+
+#endif
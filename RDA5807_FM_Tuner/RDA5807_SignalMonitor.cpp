@@ -0,0 +1,99 @@
+/*
+ Name:		RDA5807_SignalMonitor.cpp
+ Created:	18/10/2026 9:12:58 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "RDA5807_SignalMonitor.h"
+
+bool RDA5807_SignalMonitor::update(void)
+{
+	if (m_stats.samples && (millis() - m_lastSample) < m_settings.sampleInterval) return false;
+	m_lastSample = millis();
+	if (!m_receiver.updateStatusRegisters()) return false;
+
+	addSample();
+	return true;
+}
+
+void RDA5807_SignalMonitor::addSample(void)
+{
+	const uint8_t rssi = m_receiver.getRssi();
+	const bool stereo = m_receiver.getStereoIndicator();
+
+	m_events = { 0 };
+	m_stats.samples++;
+	if (m_stats.samples == 1 || rssi < m_stats.rssiMin) m_stats.rssiMin = rssi;
+	if (rssi > m_stats.rssiMax) m_stats.rssiMax = rssi;
+	if (stereo) m_stats.stereoSamples++;
+	if (m_receiver.getFmStationState()) m_stats.stationSamples++;
+
+	if (m_rssiAverage < 0) m_rssiAverage = static_cast<int32_t>(rssi) << 8;//first sample starts average
+	else m_rssiAverage += ((static_cast<int32_t>(rssi) << 8) - m_rssiAverage) >> m_settings.averageShift;
+
+	uint8_t bin = (rssi * RDA5807_MONITOR_HISTOGRAM_SIZE) / 128;
+	if (bin >= RDA5807_MONITOR_HISTOGRAM_SIZE) bin = RDA5807_MONITOR_HISTOGRAM_SIZE - 1;
+	if (m_histogram[bin] == 0xFFFF)
+		for (uint8_t i = 0; i < RDA5807_MONITOR_HISTOGRAM_SIZE; i++) m_histogram[i] >>= 1;//older samples lose half of their weight, proportions stay the same
+	m_histogram[bin]++;
+
+	if (stereo != m_stereo) m_events.stereoChanged = (m_stats.samples > 1);
+	m_stereo = stereo;
+
+	if (!m_weakSignal && (m_rssiAverage >> 8) < m_settings.weakRssi) m_weakSignal = m_events.weakSignal = true;
+	else if (m_weakSignal && (m_rssiAverage >> 8) >= (m_settings.weakRssi + m_settings.hysteresis))
+	{
+		m_weakSignal = false;
+		m_events.signalRecovered = true;
+	}
+
+	if (!m_receiver.getRdsSynchronizationState() || !m_receiver.getRdsGroupState()) return;//error levels are valid only for received group
+	const RDA5807::blockErrorLevel levels[] = { m_receiver.getBlockErrorsLevelOfRdsData0(), m_receiver.getBlockErrorsLevelOfRdsData1() };
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		const int32_t sample = (levels[i] == RDA5807::blockErrorLevel::bel6AndMoreErrors) ? 0xFFFF : 0;
+
+		m_stats.rdsBlocks++;
+		if (sample) m_stats.rdsBlockErrors++;
+		m_blockErrorAverage = static_cast<uint16_t>(m_blockErrorAverage + ((sample - m_blockErrorAverage) / (1 << m_settings.averageShift)));
+	}
+
+	const float blockErrorRate = getBlockErrorRate();
+	if (!m_highBlockErrorRate && blockErrorRate > m_settings.maxBlockErrorRate) m_highBlockErrorRate = m_events.highBlockErrorRate = true;
+	else if (m_highBlockErrorRate && blockErrorRate < (m_settings.maxBlockErrorRate / 2.0f))
+	{
+		m_highBlockErrorRate = false;
+		m_events.blockErrorRateRecovered = true;
+	}
+}
+
+void RDA5807_SignalMonitor::reset(void)
+{
+	m_events = { 0 };
+	m_stats = { 0 };
+	m_rssiAverage = -1;
+	m_blockErrorAverage = 0;
+	m_weakSignal = false;
+	m_highBlockErrorRate = false;
+	m_stereo = false;
+	memset(m_histogram, 0, sizeof(m_histogram));
+}
+
+uint8_t RDA5807_SignalMonitor::getRssiPercentile(const uint8_t& percentile) const
+{
+	uint32_t total = 0;
+	uint32_t count = 0;
+
+	for (uint8_t i = 0; i < RDA5807_MONITOR_HISTOGRAM_SIZE; i++) total += m_histogram[i];
+	if (!total) return 0;
+
+	const uint32_t target = (total * ((percentile > 100) ? 100 : percentile) + 99) / 100;
+	for (uint8_t i = 0; i < RDA5807_MONITOR_HISTOGRAM_SIZE; i++)
+	{
+		count += m_histogram[i];
+		if (count >= target && count) return static_cast<uint8_t>(((i * 128) + 64) / RDA5807_MONITOR_HISTOGRAM_SIZE);//middle of range
+	}
+	return 127;
+}
@@ -0,0 +1,206 @@
+/*
+ Name:		RDA5807_SignalMonitor.h
+ Created:	18/10/2026 9:12:58 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _RDA5807_SIGNALMONITOR_h
+#define _RDA5807_SIGNALMONITOR_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "RDA5807_FM_Tuner.h"
+
+#ifndef RDA5807_MONITOR_HISTOGRAM_SIZE
+#define RDA5807_MONITOR_HISTOGRAM_SIZE 32//number of RSSI ranges used for percentiles, RSSI range 0-127 is divided equally
+#endif
+
+class RDA5807_SignalMonitor final
+{
+public:
+	/// <summary>
+	/// Statistics of signal quality since they were reset.
+	/// </summary>
+	struct signalStats
+	{
+		uint32_t samples;//number of taken samples
+		uint32_t stereoSamples;//number of samples with stereo reception
+		uint32_t stationSamples;//number of samples in which receiver treated channel as a station
+		uint32_t rdsBlocks;//number of checked RDS blocks A and B
+		uint32_t rdsBlockErrors;//number of RDS blocks A and B with errors which couldn't be corrected
+		uint8_t rssiMin;
+		uint8_t rssiMax;
+	};
+
+private:
+	RDA5807& m_receiver;
+
+	/// <summary>
+	/// Settings of signal monitor.
+	/// </summary>
+	struct
+	{
+		uint16_t sampleInterval = 100;//time in ms between samples, 0 to take sample with every update
+		uint8_t averageShift = 3;//weight of new sample in averages is 1/(2^averageShift)
+		uint8_t weakRssi = 20;//average RSSI below which signal is treated as weak
+		uint8_t hysteresis = 4;//how much average RSSI has to be higher than weakRssi to treat signal as good again
+		uint8_t maxBlockErrorRate = 10;//average percent of RDS blocks with errors above which block error rate is treated as high
+	} m_settings;
+
+	/// <summary>
+	/// Events set by last sample.
+	/// </summary>
+	struct
+	{
+		bool weakSignal : 1;
+		bool signalRecovered : 1;
+		bool highBlockErrorRate : 1;
+		bool blockErrorRateRecovered : 1;
+		bool stereoChanged : 1;
+	} m_events = { 0 };
+
+	int32_t m_rssiAverage = -1;//average RSSI scaled by 256, -1 before first sample
+	uint16_t m_blockErrorAverage = 0;//average of uncorrectable blocks scaled by 65535
+	bool m_weakSignal = false;
+	bool m_highBlockErrorRate = false;
+	bool m_stereo = false;
+	uint16_t m_histogram[RDA5807_MONITOR_HISTOGRAM_SIZE];
+	unsigned long m_lastSample = 0;
+	signalStats m_stats = { 0 };
+
+public:
+	/// <summary>
+	/// Creates signal monitor for given receiver. Uses fixed amount of memory, all statistics are updated incrementally.
+	/// Events can be used for AF following, soft mute tuning or sending telemetry.
+	/// </summary>
+	/// <param name="receiver">monitored receiver</param>
+	RDA5807_SignalMonitor(RDA5807& receiver) : m_receiver(receiver) { reset(); }
+
+	RDA5807_SignalMonitor(const RDA5807_SignalMonitor&) = delete;
+	RDA5807_SignalMonitor& operator=(const RDA5807_SignalMonitor&) = delete;
+
+	/// <summary>
+	/// Takes sample if sample interval passed. Registers 0x0A and 0x0B are read with one read operation.
+	/// Call it as often as possible, for example in main loop. Events are cleared when next sample is taken.
+	/// </summary>
+	/// <returns>true if sample was taken, false otherwise</returns>
+	bool update(void);
+
+	/// <summary>
+	/// Adds sample using registers which were already read from receiver, for example by other module. Events are cleared before adding.
+	/// </summary>
+	void addSample(void);
+
+	/// <summary>
+	/// Clears statistics, averages and state. Call it after frequency change.
+	/// </summary>
+	void reset(void);
+
+	/// <summary>
+	/// Sets sampling parameters.
+	/// </summary>
+	/// <param name="sampleInterval">time in ms between samples, 0 to take sample with every update</param>
+	/// <param name="averageShift">weight of new sample in averages is 1/(2^averageShift), from 0 to 8</param>
+	void setSampling(const uint16_t& sampleInterval, const uint8_t& averageShift = 3)
+	{
+		m_settings.sampleInterval = sampleInterval;
+		m_settings.averageShift = (averageShift > 8) ? 8 : averageShift;
+	}
+
+	/// <summary>
+	/// Sets thresholds which trigger events.
+	/// </summary>
+	/// <param name="weakRssi">average RSSI below which signal is treated as weak</param>
+	/// <param name="hysteresis">how much average RSSI has to be higher than weakRssi to treat signal as good again</param>
+	/// <param name="maxBlockErrorRate">average percent of RDS blocks with errors above which block error rate is treated as high</param>
+	void setThresholds(const uint8_t& weakRssi, const uint8_t& hysteresis = 4, const uint8_t& maxBlockErrorRate = 10)
+	{
+		m_settings.weakRssi = weakRssi;
+		m_settings.hysteresis = hysteresis;
+		m_settings.maxBlockErrorRate = maxBlockErrorRate;
+	}
+
+#pragma region statistics
+	/// <summary>
+	/// Returns exponentially weighted moving average of RSSI.
+	/// </summary>
+	/// <returns>average RSSI, 0 if no sample was taken</returns>
+	float getRssiAverage(void) const { return (m_rssiAverage < 0) ? 0 : m_rssiAverage / 256.0f; }
+
+	/// <summary>
+	/// Returns RSSI value below which given percent of samples is. Value is approximated with resolution of one histogram range.
+	/// </summary>
+	/// <param name="percentile">percentile, from 0 to 100</param>
+	/// <returns>RSSI value, 0 if no sample was taken</returns>
+	uint8_t getRssiPercentile(const uint8_t& percentile) const;
+
+	/// <summary>
+	/// Returns exponentially weighted moving average of RDS block error rate. Only blocks A and B are checked by receiver.
+	/// </summary>
+	/// <returns>percent of blocks with errors which couldn't be corrected</returns>
+	float getBlockErrorRate(void) const { return (m_blockErrorAverage * 100.0f) / 0xFFFF; }
+
+	/// <summary>
+	/// Returns statistics since they were reset.
+	/// </summary>
+	/// <returns>signal statistics</returns>
+	const signalStats& getStats(void) const { return m_stats; }
+#pragma endregion
+#pragma region state and events
+	/// <summary>
+	/// Returns information if signal is weak.
+	/// </summary>
+	/// <returns>true if average RSSI is below threshold, false otherwise</returns>
+	bool getWeakSignal(void) const { return m_weakSignal; }
+
+	/// <summary>
+	/// Returns information if RDS block error rate is high.
+	/// </summary>
+	/// <returns>true if average block error rate is above threshold, false otherwise</returns>
+	bool getHighBlockErrorRate(void) const { return m_highBlockErrorRate; }
+
+	/// <summary>
+	/// Returns information if last sample was received in stereo.
+	/// </summary>
+	/// <returns>true if stereo, false otherwise</returns>
+	bool getStereo(void) const { return m_stereo; }
+
+	/// <summary>
+	/// Returns information if last sample made signal weak.
+	/// </summary>
+	/// <returns>true if average RSSI dropped below threshold, false otherwise</returns>
+	bool getWeakSignalEvent(void) const { return m_events.weakSignal; }
+
+	/// <summary>
+	/// Returns information if last sample made signal good again.
+	/// </summary>
+	/// <returns>true if average RSSI rose above threshold and hysteresis, false otherwise</returns>
+	bool getSignalRecoveredEvent(void) const { return m_events.signalRecovered; }
+
+	/// <summary>
+	/// Returns information if last sample made RDS block error rate high.
+	/// </summary>
+	/// <returns>true if average block error rate rose above threshold, false otherwise</returns>
+	bool getHighBlockErrorRateEvent(void) const { return m_events.highBlockErrorRate; }
+
+	/// <summary>
+	/// Returns information if last sample made RDS block error rate low again.
+	/// </summary>
+	/// <returns>true if average block error rate dropped below half of threshold, false otherwise</returns>
+	bool getBlockErrorRateRecoveredEvent(void) const { return m_events.blockErrorRateRecovered; }
+
+	/// <summary>
+	/// Returns information if reception changed between mono and stereo in last sample.
+	/// </summary>
+	/// <returns>true if stereo indicator changed, false otherwise</returns>
+	bool getStereoChangedEvent(void) const { return m_events.stereoChanged; }
+#pragma endregion
+};
+
+#endif
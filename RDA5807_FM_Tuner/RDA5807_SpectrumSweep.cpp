@@ -0,0 +1,91 @@
+/*
+ Name:		RDA5807_SpectrumSweep.cpp
+ Created:	18/10/2026 7:48:35 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "RDA5807_SpectrumSweep.h"
+#include "RDA5807_Utilities.h"
+
+bool RDA5807_SpectrumSweep::begin(const uint16_t& from, const uint16_t& to, const sweepStep& step, uint8_t* results, const uint16_t& size)
+{
+	uint16_t lastOffset = 0;
+
+	if (results == nullptr || !size || to < from) return false;
+	if (!RDA5807_Utilities::getFrequencyOffset(from, m_firstOffset, m_receiver.getBand(), !m_receiver.get65mMode())) return false;
+	if (!RDA5807_Utilities::getFrequencyOffset(to, lastOffset, m_receiver.getBand(), !m_receiver.get65mMode())) return false;
+
+	if (m_state == state::disabled)
+	{
+		m_wasMuted = m_receiver.getMute();
+		m_wasDirectMode = m_receiver.getAlternativeFrequencySettingMode();
+	}
+	m_receiver.setMute(true);
+	m_receiver.setAlternativeFrequencySettingMode(true);
+	if (!m_receiver.writeSettingsToReceiver()) return false;//in this mode all registers have to be written once
+
+	m_step = static_cast<uint8_t>(step);
+	m_firstFrequency = from;
+	m_results = results;
+	m_pointCount = ((lastOffset - m_firstOffset) / m_step) + 1;
+	if (m_pointCount > size) m_pointCount = size;
+	restart();
+	return true;
+}
+
+void RDA5807_SpectrumSweep::restart(void)
+{
+	if (m_results == nullptr) return;//sweep wasn't started
+
+	m_pointIndex = 0;
+	m_sweepStart = micros();
+	m_sweepStartBytes = m_receiver.getI2cHealth().bytesTransferred;
+	startPoint();
+}
+
+void RDA5807_SpectrumSweep::end(void)
+{
+	if (m_state == state::disabled) return;
+
+	m_receiver.setMute(m_wasMuted);
+	m_receiver.setAlternativeFrequencySettingMode(m_wasDirectMode);
+	m_receiver.writeSettingsToReceiver();
+	m_results = nullptr;
+	m_state = state::disabled;
+}
+
+bool RDA5807_SpectrumSweep::update(void)
+{
+	if (m_state != state::settling) return false;
+	if (!m_pointFailed && (micros() - m_pointStart) < m_settleTime) return false;
+
+	if (m_pointFailed) m_results[m_pointIndex] = 0;//receiver is still at previous frequency, so there is nothing to measure
+	else if (m_receiver.updateRssi()) m_results[m_pointIndex] = (m_receiver.getRssi() & 0x7F) | (m_receiver.getFmStationState() ? 0x80 : 0x00);
+	else
+	{
+		m_results[m_pointIndex] = 0;
+		m_stats.failedPoints++;
+	}
+
+	if (++m_pointIndex < m_pointCount)
+	{
+		startPoint();
+		return false;
+	}
+
+	m_stats.sweeps++;
+	m_stats.lastSweepTime = micros() - m_sweepStart;
+	m_stats.lastSweepBytes = m_receiver.getI2cHealth().bytesTransferred - m_sweepStartBytes;
+	m_state = state::complete;
+	return true;
+}
+
+void RDA5807_SpectrumSweep::startPoint(void)
+{
+	m_pointFailed = !m_receiver.startDirectFrequencyChange(m_firstOffset + (m_pointIndex * m_step));
+	if (m_pointFailed) m_stats.failedPoints++;
+	m_pointStart = micros();
+	m_state = state::settling;
+}
@@ -0,0 +1,160 @@
+/*
+ Name:		RDA5807_SpectrumSweep.h
+ Created:	18/10/2026 7:48:35 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _RDA5807_SPECTRUMSWEEP_h
+#define _RDA5807_SPECTRUMSWEEP_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "RDA5807_FM_Tuner.h"
+
+class RDA5807_SpectrumSweep final
+{
+public:
+	/// <summary>
+	/// Possible distances between measured points.
+	/// </summary>
+	enum class sweepStep : uint8_t { step25kHz = 25, step50kHz = 50, step100kHz = 100, step200kHz = 200 };
+
+	/// <summary>
+	/// Statistics of spectrum sweep.
+	/// </summary>
+	struct sweepStats
+	{
+		uint16_t sweeps;//number of completed sweeps
+		uint16_t failedPoints;//number of points which couldn't be measured because of communication error
+		uint32_t lastSweepTime;//time in us of last completed sweep
+		uint32_t lastSweepBytes;//number of bytes transferred over I2C during last completed sweep
+	};
+
+private:
+	/// <summary>
+	/// Possible states of spectrum sweep.
+	/// </summary>
+	enum class state : uint8_t { disabled, settling, complete };
+
+	RDA5807& m_receiver;
+	state m_state = state::disabled;
+	uint16_t m_settleTime = 2000;//time in us to wait after frequency change before signal is measured
+	uint8_t* m_results = nullptr;
+	uint16_t m_pointCount = 0;
+	uint16_t m_pointIndex = 0;
+	uint16_t m_firstOffset = 0;//offset in kHz of first point from the beginning of band
+	uint8_t m_step = 0;//distance between points in kHz
+	uint16_t m_firstFrequency = 0;
+	bool m_pointFailed = false;//frequency of current point wasn't set
+	bool m_wasMuted = false;
+	bool m_wasDirectMode = false;
+	unsigned long m_pointStart = 0;
+	unsigned long m_sweepStart = 0;
+	uint32_t m_sweepStartBytes = 0;
+	sweepStats m_stats = { 0 };
+
+public:
+	/// <summary>
+	/// Creates spectrum sweep for given receiver. Frequency is changed in alternative frequency setting mode, so there is no tune operation
+	/// and only one register is written for every point.
+	/// </summary>
+	/// <param name="receiver">receiver which will be retuned</param>
+	RDA5807_SpectrumSweep(RDA5807& receiver) : m_receiver(receiver) {}
+
+	RDA5807_SpectrumSweep(const RDA5807_SpectrumSweep&) = delete;
+	RDA5807_SpectrumSweep& operator=(const RDA5807_SpectrumSweep&) = delete;
+
+	/// <summary>
+	/// Starts sweep of given range. Audio is muted and alternative frequency setting mode is enabled until sweep is ended.
+	/// For every point one byte is written to results: RSSI in bits 0-6 and state of fmStation flag in bit 7, see getPointRssi() and getPointFmStation().
+	/// Pass values without decimal place, ex: 919 is 91.9Mhz.
+	/// </summary>
+	/// <param name="from">first frequency</param>
+	/// <param name="to">last frequency</param>
+	/// <param name="step">distance between points</param>
+	/// <param name="results">array for results, it has to exist until sweep is completed</param>
+	/// <param name="size">size of array, range is shortened if it is too small</param>
+	/// <returns>true if sweep was started, false if range is outside of selected band or settings couldn't be written</returns>
+	bool begin(const uint16_t& from, const uint16_t& to, const sweepStep& step, uint8_t* results, const uint16_t& size);
+
+	/// <summary>
+	/// Starts next sweep of the same range into the same array.
+	/// </summary>
+	void restart(void);
+
+	/// <summary>
+	/// Stops sweep, restores frequency setting mode and mute state. Tune receiver to desired frequency after that.
+	/// </summary>
+	void end(void);
+
+	/// <summary>
+	/// Performs next step of sweep. It never waits for receiver, so call it as often as possible, for example in main loop.
+	/// </summary>
+	/// <returns>true if sweep was completed during this call, false otherwise</returns>
+	bool update(void);
+
+	/// <summary>
+	/// Sets time to wait after frequency change before signal is measured. Shorter time gives faster sweep, but RSSI can be taken before it settles.
+	/// </summary>
+	/// <param name="settleTime">time in us</param>
+	void setSettleTime(const uint16_t& settleTime) { m_settleTime = settleTime; }
+
+	/// <summary>
+	/// Returns information if sweep of whole range was completed.
+	/// </summary>
+	/// <returns>true if sweep is completed, false otherwise</returns>
+	bool getComplete(void) const { return m_state == state::complete; }
+
+	/// <summary>
+	/// Returns number of points in swept range.
+	/// </summary>
+	/// <returns>number of points</returns>
+	uint16_t getPointCount(void) const { return m_pointCount; }
+
+	/// <summary>
+	/// Returns frequency of point with given index.
+	/// </summary>
+	/// <param name="index">index of point</param>
+	/// <returns>frequency in kHz</returns>
+	uint32_t getPointFrequency(const uint16_t& index) const { return (m_firstFrequency * 100UL) + (static_cast<uint32_t>(index) * m_step); }
+
+	/// <summary>
+	/// Returns RSSI stored in result of point.
+	/// </summary>
+	/// <param name="result">result of point</param>
+	/// <returns>RSSI value</returns>
+	static uint8_t getPointRssi(const uint8_t& result) { return result & 0x7F; }
+
+	/// <summary>
+	/// Returns state of fmStation flag stored in result of point.
+	/// </summary>
+	/// <param name="result">result of point</param>
+	/// <returns>true if receiver treated point as a station, false otherwise</returns>
+	static bool getPointFmStation(const uint8_t& result) { return (result & 0x80) != 0; }
+
+	/// <summary>
+	/// Returns statistics of spectrum sweep.
+	/// </summary>
+	/// <returns>sweep statistics</returns>
+	const sweepStats& getStats(void) const { return m_stats; }
+
+	/// <summary>
+	/// Returns number of points measured per second during last completed sweep.
+	/// </summary>
+	/// <returns>points per second</returns>
+	float getPointsPerSecond(void) const { return m_stats.lastSweepTime ? (m_pointCount * 1000000.0f) / m_stats.lastSweepTime : 0; }
+
+private:
+	/// <summary>
+	/// Changes frequency to point with current index.
+	/// </summary>
+	void startPoint(void);
+};
+
+#endif
@@ -0,0 +1,180 @@
+/*
+ Name:		RDA5807_StationDatabase.cpp
+ Created:	18/10/2026 6:27:13 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "RDA5807_StationDatabase.h"
+
+#if defined(__AVR__)
+#define RDA5807_MEMORY_BARRIER() __asm__ __volatile__("" ::: "memory")//single core, only compiler can reorder accesses
+#else
+#define RDA5807_MEMORY_BARRIER() __sync_synchronize()
+#endif
+
+bool RDA5807_StationDatabase::updateStation(const uint16_t& programmeIdentification, const uint16_t& freq, const uint8_t& rssi, const uint8_t& programmeType, const char* programmeServiceName)
+{
+	uint8_t index = findStationIndex(programmeIdentification);
+	const bool added = (index == 0xFF);
+
+	beginWrite();
+	if (added)
+	{
+		if (m_stationCount < RDA5807_DATABASE_STATION_COUNT) index = m_stationCount;
+		else
+		{//database is full, replace station which wasn't seen for the longest time
+			index = 0;
+			for (uint8_t i = 1; i < RDA5807_DATABASE_STATION_COUNT; i++)
+				if (getStationAge(m_stations[i]) > getStationAge(m_stations[index])) index = i;
+		}
+		memset(&m_stations[index], 0, sizeof(station));
+		m_stations[index].programmeIdentification = programmeIdentification;
+	}
+
+	station& data = m_stations[index];
+	setStationFrequency(data, freq, rssi);
+	data.programmeType = programmeType;
+	data.lastSeen = millis();
+	if (programmeServiceName != nullptr) memcpy(data.programmeServiceName, programmeServiceName, sizeof(data.programmeServiceName));
+	if (index == m_stationCount) m_stationCount++;//station is complete, readers can see it
+	endWrite();
+	return added;
+}
+
+void RDA5807_StationDatabase::addAlternativeFrequency(const uint16_t& programmeIdentification, const uint16_t& freq)
+{
+	const uint8_t index = findStationIndex(programmeIdentification);
+
+	if (index == 0xFF) return;
+	beginWrite();
+	setStationFrequency(m_stations[index], freq, 0);
+	endWrite();
+}
+
+void RDA5807_StationDatabase::removeStationsOlderThan(const unsigned long& maxAge)
+{
+	beginWrite();
+	for (uint8_t i = 0; i < m_stationCount;)
+	{
+		if (getStationAge(m_stations[i]) > maxAge)
+		{//last station takes place of removed one
+			m_stations[i] = m_stations[m_stationCount - 1];
+			m_stationCount--;
+		}
+		else i++;
+	}
+	endWrite();
+}
+
+void RDA5807_StationDatabase::clear(void)
+{
+	beginWrite();
+	m_stationCount = 0;
+	endWrite();
+}
+
+bool RDA5807_StationDatabase::getStation(const uint8_t& index, station& dest) const
+{
+	for (uint8_t attempt = 0; attempt < RDA5807_DATABASE_READ_ATTEMPTS; attempt++)
+	{
+		const uint8_t sequence = m_sequence;
+
+		if (sequence & 0x01) continue;//writer is in progress
+		RDA5807_MEMORY_BARRIER();
+		if (index >= m_stationCount) return false;
+		dest = m_stations[index];
+		RDA5807_MEMORY_BARRIER();
+		if (sequence == m_sequence) return true;
+	}
+	return false;
+}
+
+bool RDA5807_StationDatabase::findStation(const uint16_t& programmeIdentification, station& dest) const
+{
+	for (uint8_t attempt = 0; attempt < RDA5807_DATABASE_READ_ATTEMPTS; attempt++)
+	{
+		const uint8_t sequence = m_sequence;
+		uint8_t index = 0xFF;
+
+		if (sequence & 0x01) continue;//writer is in progress
+		RDA5807_MEMORY_BARRIER();
+		for (uint8_t i = 0; i < m_stationCount; i++)
+			if (m_stations[i].programmeIdentification == programmeIdentification)
+			{
+				index = i;
+				break;
+			}
+		if (index != 0xFF) dest = m_stations[index];
+		RDA5807_MEMORY_BARRIER();
+		if (sequence == m_sequence) return index != 0xFF;
+	}
+	return false;
+}
+
+unsigned long RDA5807_StationDatabase::getMaxStationAge(void) const
+{
+	unsigned long maxAge = 0;
+	station data;
+
+	for (uint8_t i = 0; i < getStationCount(); i++)
+		if (getStation(i, data) && getStationAge(data) > maxAge) maxAge = getStationAge(data);
+	return maxAge;
+}
+
+uint8_t RDA5807_StationDatabase::getStrongestFrequency(const station& data, const uint16_t& excludedFrequency)
+{
+	uint8_t best = 0xFF;
+
+	for (uint8_t i = 0; i < data.frequencyCount; i++)
+		if (data.rssi[i] && data.frequencies[i] != excludedFrequency && (best == 0xFF || data.rssi[i] > data.rssi[best])) best = i;
+	return best;
+}
+
+uint8_t RDA5807_StationDatabase::getFrequencyRssi(const station& data, const uint16_t& freq)
+{
+	for (uint8_t i = 0; i < data.frequencyCount; i++)
+		if (data.frequencies[i] == freq) return data.rssi[i];
+	return 0;
+}
+
+void RDA5807_StationDatabase::beginWrite(void)
+{
+	m_sequence = m_sequence + 1;
+	RDA5807_MEMORY_BARRIER();
+}
+
+void RDA5807_StationDatabase::endWrite(void)
+{
+	RDA5807_MEMORY_BARRIER();
+	m_sequence = m_sequence + 1;
+}
+
+uint8_t RDA5807_StationDatabase::findStationIndex(const uint16_t& programmeIdentification) const
+{
+	for (uint8_t i = 0; i < m_stationCount; i++)
+		if (m_stations[i].programmeIdentification == programmeIdentification) return i;
+	return 0xFF;
+}
+
+void RDA5807_StationDatabase::setStationFrequency(station& data, const uint16_t& freq, const uint8_t& rssi)
+{
+	uint8_t weakest = 0;
+
+	if (!freq) return;
+	for (uint8_t i = 0; i < data.frequencyCount; i++)
+	{
+		if (data.frequencies[i] == freq)
+		{
+			if (rssi) data.rssi[i] = rssi;//AF list doesn't change measured value
+			return;
+		}
+		if (data.rssi[i] < data.rssi[weakest]) weakest = i;
+	}
+
+	if (data.frequencyCount < RDA5807_DATABASE_FREQUENCY_COUNT) weakest = data.frequencyCount++;
+	else if (rssi <= data.rssi[weakest]) return;//all stored frequencies are stronger
+	data.frequencies[weakest] = freq;
+	data.rssi[weakest] = rssi;
+}
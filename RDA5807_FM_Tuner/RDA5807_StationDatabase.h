@@ -0,0 +1,174 @@
+/*
+ Name:		RDA5807_StationDatabase.h
+ Created:	18/10/2026 6:27:13 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _RDA5807_STATIONDATABASE_h
+#define _RDA5807_STATIONDATABASE_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#ifndef RDA5807_DATABASE_STATION_COUNT
+#define RDA5807_DATABASE_STATION_COUNT 8//max number of stations in database
+#endif
+
+#ifndef RDA5807_DATABASE_FREQUENCY_COUNT
+#define RDA5807_DATABASE_FREQUENCY_COUNT 5//max number of frequencies stored for one station
+#endif
+
+#ifndef RDA5807_DATABASE_READ_ATTEMPTS
+#define RDA5807_DATABASE_READ_ATTEMPTS 8//max number of attempts to read station which is being written at the same time
+#endif
+
+/// <summary>
+/// Database of received stations shared between receivers. Stations are written by one writer, for example survey running on dedicated receiver,
+/// and can be read without locking from other code, also from interrupts or other core. Reader copies station and repeats copying
+/// if database was changed in the meantime (sequence lock), so writer is never blocked.
+/// </summary>
+class RDA5807_StationDatabase final
+{
+public:
+	/// <summary>
+	/// Station stored in database.
+	/// </summary>
+	struct station
+	{
+		uint16_t programmeIdentification;
+		uint8_t programmeType;//PTY code
+		char programmeServiceName[9];//8 chars for station name and one 0 as end mark, empty if it wasn't received completely
+		uint8_t frequencyCount;
+		uint16_t frequencies[RDA5807_DATABASE_FREQUENCY_COUNT];//frequencies on which station was found or which are on its AF list, ex: 919 is 91.9Mhz
+		uint8_t rssi[RDA5807_DATABASE_FREQUENCY_COUNT];//RSSI measured on frequency, 0 if frequency is only known from AF list
+		unsigned long lastSeen;//value of millis() when station was received last time
+	};
+
+private:
+	station m_stations[RDA5807_DATABASE_STATION_COUNT];
+	volatile uint8_t m_stationCount = 0;
+	volatile uint8_t m_sequence = 0;//odd while database is being written
+
+public:
+	RDA5807_StationDatabase() {}
+
+	RDA5807_StationDatabase(const RDA5807_StationDatabase&) = delete;
+	RDA5807_StationDatabase& operator=(const RDA5807_StationDatabase&) = delete;
+
+#pragma region writer
+	/// <summary>
+	/// Adds station or updates already stored one. If database is full, station which wasn't seen for the longest time is replaced.
+	/// RSSI of given frequency is replaced by new value. If frequency list is full, the weakest frequency is replaced if new one is stronger.
+	/// </summary>
+	/// <param name="programmeIdentification">PI code</param>
+	/// <param name="freq">frequency on which station was received</param>
+	/// <param name="rssi">RSSI measured on that frequency</param>
+	/// <param name="programmeType">PTY code</param>
+	/// <param name="programmeServiceName">complete station name, nullptr if it wasn't received</param>
+	/// <returns>true if station was added, false if it was already stored</returns>
+	bool updateStation(const uint16_t& programmeIdentification, const uint16_t& freq, const uint8_t& rssi, const uint8_t& programmeType, const char* programmeServiceName);
+
+	/// <summary>
+	/// Adds frequency from AF list to stored station. Frequencies already on the list and frequencies which don't fit in the list are skipped.
+	/// </summary>
+	/// <param name="programmeIdentification">PI code</param>
+	/// <param name="freq">frequency value</param>
+	void addAlternativeFrequency(const uint16_t& programmeIdentification, const uint16_t& freq);
+
+	/// <summary>
+	/// Removes stations which weren't seen for given time.
+	/// </summary>
+	/// <param name="maxAge">time in ms</param>
+	void removeStationsOlderThan(const unsigned long& maxAge);
+
+	/// <summary>
+	/// Removes all stations.
+	/// </summary>
+	void clear(void);
+#pragma endregion
+#pragma region reader
+	/// <summary>
+	/// Returns number of stored stations.
+	/// </summary>
+	/// <returns>number of stations</returns>
+	uint8_t getStationCount(void) const { return m_stationCount; }
+
+	/// <summary>
+	/// Copies station with given index.
+	/// </summary>
+	/// <param name="index">index of station, from 0 to getStationCount() - 1</param>
+	/// <param name="dest">where to copy station</param>
+	/// <returns>true if station was copied, false if index is out of range or database was being written during all attempts</returns>
+	bool getStation(const uint8_t& index, station& dest) const;
+
+	/// <summary>
+	/// Copies station with given PI code.
+	/// </summary>
+	/// <param name="programmeIdentification">PI code</param>
+	/// <param name="dest">where to copy station</param>
+	/// <returns>true if station was copied, false if it isn't stored or database was being written during all attempts</returns>
+	bool findStation(const uint16_t& programmeIdentification, station& dest) const;
+
+	/// <summary>
+	/// Returns time since station was received last time.
+	/// </summary>
+	/// <param name="data">copied station</param>
+	/// <returns>time in ms</returns>
+	static unsigned long getStationAge(const station& data) { return millis() - data.lastSeen; }
+
+	/// <summary>
+	/// Returns time since the oldest stored station was received last time, which tells how fresh is the database.
+	/// </summary>
+	/// <returns>time in ms, 0 if database is empty</returns>
+	unsigned long getMaxStationAge(void) const;
+
+	/// <summary>
+	/// Returns the strongest measured frequency of station.
+	/// </summary>
+	/// <param name="data">copied station</param>
+	/// <param name="excludedFrequency">frequency which can't be returned, for example currently received one</param>
+	/// <returns>index of frequency in station, 0xFF if there is no measured frequency</returns>
+	static uint8_t getStrongestFrequency(const station& data, const uint16_t& excludedFrequency = 0);
+
+	/// <summary>
+	/// Returns RSSI measured on frequency of station.
+	/// </summary>
+	/// <param name="data">copied station</param>
+	/// <param name="freq">frequency value</param>
+	/// <returns>RSSI, 0 if frequency wasn't measured</returns>
+	static uint8_t getFrequencyRssi(const station& data, const uint16_t& freq);
+#pragma endregion
+
+private:
+	/// <summary>
+	/// Marks beginning of write, readers will repeat copying of stations.
+	/// </summary>
+	void beginWrite(void);
+
+	/// <summary>
+	/// Marks end of write.
+	/// </summary>
+	void endWrite(void);
+
+	/// <summary>
+	/// Returns index of station with given PI code. Used only by writer.
+	/// </summary>
+	/// <param name="programmeIdentification">PI code</param>
+	/// <returns>index of station, 0xFF if it isn't stored</returns>
+	uint8_t findStationIndex(const uint16_t& programmeIdentification) const;
+
+	/// <summary>
+	/// Adds frequency to station or updates its RSSI.
+	/// </summary>
+	/// <param name="data">stored station</param>
+	/// <param name="freq">frequency value</param>
+	/// <param name="rssi">measured RSSI, 0 if frequency is only known from AF list</param>
+	static void setStationFrequency(station& data, const uint16_t& freq, const uint8_t& rssi);
+};
+
+#endif
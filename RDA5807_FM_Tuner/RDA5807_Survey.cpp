@@ -0,0 +1,161 @@
+/*
+ Name:		RDA5807_Survey.cpp
+ Created:	18/10/2026 3:41:07 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "RDA5807_Survey.h"
+
+void RDA5807_Survey::begin(const uint16_t* frequencies, const uint8_t& count)
+{
+	m_frequencies = frequencies;
+	m_channelCount = count;
+	start();
+}
+
+void RDA5807_Survey::begin(const uint16_t& from, const uint16_t& to, const uint16_t& step)
+{
+	m_frequencies = nullptr;
+	m_firstFrequency = from;
+	m_frequencyStep = step ? step : 1;
+	m_channelCount = 0;
+	if (to >= from) m_channelCount = static_cast<uint16_t>(((to - from) / m_frequencyStep) + 1);
+	start();
+}
+
+void RDA5807_Survey::end(void)
+{
+	if (m_state == state::disabled) return;
+	m_receiver.updateMute(m_wasMuted);
+	m_receiver.clearDecodedRdsStationData();
+	m_state = state::disabled;
+}
+
+bool RDA5807_Survey::update(void)
+{
+	switch (m_state)
+	{
+	case state::settling:
+		updateSettling();
+		return false;
+
+	case state::collecting:
+		return updateCollecting();
+
+	default:
+		return false;
+	}
+}
+
+float RDA5807_Survey::getStationsPerMinute(void) const
+{
+	const unsigned long time = millis() - m_stats.startTime;
+
+	if (!time) return 0;
+	return (m_stats.stationsFound * 60000.0f) / time;
+}
+
+uint32_t RDA5807_Survey::getBusLoad(void) const
+{
+	const unsigned long time = millis() - m_stats.startTime;
+
+	if (!time) return 0;
+	return static_cast<uint32_t>((m_stats.i2cBytes * 1000ULL) / time);
+}
+
+void RDA5807_Survey::start(void)
+{
+	if (!m_channelCount || m_receiver.getDecodedRdsData() == nullptr) return;//nothing to survey or RDS decoding is disabled
+
+	if (m_state == state::disabled) m_wasMuted = m_receiver.getMute();
+	m_stats = { 0 };
+	m_stats.startTime = millis();
+	m_i2cHealthAtStart = m_receiver.getI2cHealth();
+	m_receiver.updateMute(true);
+	m_channelIndex = 0;
+	m_started = false;
+	m_state = state::settling;
+	startNextChannel();
+}
+
+void RDA5807_Survey::updateSettling(void)
+{
+	if ((millis() - m_channelStart) < m_settings.settleTime) return;
+	if (!m_receiver.checkIfTuneIsComplete())
+	{
+		if ((millis() - m_channelStart) > (m_settings.settleTime + m_settings.syncTimeout)) startNextChannel();//receiver can't tune to this frequency
+		return;
+	}
+
+	m_rssi = m_receiver.getRssi();
+	if (m_rssi < m_settings.minRssi)
+	{//no point in waiting for RDS
+		startNextChannel();
+		return;
+	}
+	m_state = state::collecting;
+}
+
+bool RDA5807_Survey::updateCollecting(void)
+{
+	const RdsDecoder* const rds = m_receiver.getDecodedRdsData();
+	const unsigned long time = millis() - m_channelStart;
+
+	if (!m_receiver.checkIfNewRdsDataIsReady())
+	{
+		if ((time > m_settings.syncTimeout && !m_receiver.getRdsSynchronizationState()) ||
+			(time > m_settings.piTimeout && !rds->getConfirmedProgrammeIdentification()))
+		{//there is no RDS on this channel
+			startNextChannel();
+			return false;
+		}
+		if (time <= m_settings.maxDwell) return false;
+	}
+	else if (m_receiver.updateRdsData()) m_receiver.updateDecodedRdsData();
+
+	if (!rds->getConfirmedProgrammeIdentification())
+	{
+		if (time > m_settings.maxDwell) startNextChannel();
+		return false;
+	}
+
+	RDA5807_StationDatabase::station known;
+	if (time <= m_settings.maxDwell && !rds->getProgrammeServiceNameComplete() &&
+		(!m_database.findStation(rds->getConfirmedProgrammeIdentification(), known) || !known.programmeServiceName[0])) return false;//wait for PS, unless it is already known
+
+	m_stats.rdsChannels++;
+	updateDatabase(*rds);
+	startNextChannel();
+	return true;
+}
+
+void RDA5807_Survey::startNextChannel(void)
+{
+	if (!m_started) m_started = true;//first channel of survey
+	else if (++m_channelIndex >= m_channelCount)
+	{
+		m_stats.rounds++;
+		m_channelIndex = 0;
+	}
+
+	m_stats.i2cTransactions = m_receiver.getI2cHealth().transactions - m_i2cHealthAtStart.transactions;
+	m_stats.i2cBytes = m_receiver.getI2cHealth().bytesTransferred - m_i2cHealthAtStart.bytesTransferred;
+	m_stats.visitedChannels++;
+	m_frequency = getChannelFrequency(m_channelIndex);
+	m_receiver.clearDecodedRdsStationData();//data from previous channel can't be mixed with new one
+	m_receiver.startFrequencyChange(m_frequency);//if it fails, channel will be skipped after timeout
+	m_channelStart = millis();
+	m_state = state::settling;
+}
+
+void RDA5807_Survey::updateDatabase(const RdsDecoder& rds)
+{
+	const uint16_t programmeIdentification = rds.getConfirmedProgrammeIdentification();
+
+	if (m_database.updateStation(programmeIdentification, m_frequency, m_rssi, rds.getProgrammeTypeCode(),
+		rds.getProgrammeServiceNameComplete() ? rds.getProgrammeServiceName() : nullptr)) m_stats.stationsFound++;
+	if (rds.getAlternativeFrequencyListPi() == programmeIdentification)
+		for (uint8_t i = 0; i < rds.getAlternativeFrequencyCount(); i++) m_database.addAlternativeFrequency(programmeIdentification, rds.getAlternativeFrequency(i));
+}
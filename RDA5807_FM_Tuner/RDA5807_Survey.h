@@ -0,0 +1,202 @@
+/*
+ Name:		RDA5807_Survey.h
+ Created:	18/10/2026 3:41:07 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _RDA5807_SURVEY_h
+#define _RDA5807_SURVEY_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "RDA5807_FM_Tuner.h"
+#include "RDA5807_StationDatabase.h"
+
+class RDA5807_Survey final
+{
+public:
+	/// <summary>
+	/// Statistics of survey.
+	/// </summary>
+	struct surveyStats
+	{
+		uint16_t rounds;//number of completed rounds through channel list
+		uint32_t visitedChannels;//number of channels to which receiver was tuned
+		uint32_t rdsChannels;//number of visited channels on which PI was confirmed
+		uint16_t stationsFound;//number of stations added to database
+		unsigned long startTime;//value of millis() when survey was started
+		uint32_t i2cTransactions;//number of I2C transactions since survey was started
+		uint32_t i2cBytes;//number of bytes transferred over I2C since survey was started
+	};
+
+private:
+	/// <summary>
+	/// Possible states of survey.
+	/// </summary>
+	enum class state : uint8_t { disabled, settling, collecting };
+
+	RDA5807& m_receiver;
+	RDA5807_StationDatabase& m_database;
+	state m_state = state::disabled;
+
+	/// <summary>
+	/// Settings of survey.
+	/// </summary>
+	struct
+	{
+		uint8_t minRssi = 20;//RSSI below which channel is skipped without waiting for RDS
+		uint16_t settleTime = 10;//time in ms to wait after frequency change before signal is measured
+		uint16_t syncTimeout = 250;//max time in ms to wait for RDS synchronization
+		uint16_t piTimeout = 600;//max time in ms to wait for confirmed PI
+		uint16_t maxDwell = 2500;//max time in ms spent on one channel
+	} m_settings;
+
+	const uint16_t* m_frequencies = nullptr;//channel list, nullptr if range is used
+	uint16_t m_firstFrequency = 0;
+	uint16_t m_frequencyStep = 0;
+	uint16_t m_channelCount = 0;
+	uint16_t m_channelIndex = 0;
+	bool m_started = false;//set when first channel of survey is visited
+	uint16_t m_frequency = 0;//currently visited frequency
+	uint8_t m_rssi = 0;
+	bool m_wasMuted = false;
+	unsigned long m_channelStart = 0;
+	surveyStats m_stats = { 0 };
+	RDA5807::i2cHealth m_i2cHealthAtStart = { 0 };
+
+public:
+	/// <summary>
+	/// Creates survey scheduler for given receiver. RDS decoder has to be enabled in receiver.
+	/// Alternative frequency setting mode of receiver is recommended, because it changes frequency without tune operation.
+	/// Dedicated receiver can survey the band continuously, while other one plays audio and reads found stations from the same database.
+	/// </summary>
+	/// <param name="receiver">receiver which will be retuned</param>
+	/// <param name="database">database to which found stations are written</param>
+	RDA5807_Survey(RDA5807& receiver, RDA5807_StationDatabase& database) : m_receiver(receiver), m_database(database) {}
+
+	RDA5807_Survey(const RDA5807_Survey&) = delete;
+	RDA5807_Survey& operator=(const RDA5807_Survey&) = delete;
+
+	/// <summary>
+	/// Starts survey of frequencies from given list. List isn't copied, so it has to exist until survey is ended.
+	/// Audio is muted during survey. Pass values without decimal place, ex: 919 is 91.9Mhz.
+	/// </summary>
+	/// <param name="frequencies">list of frequencies</param>
+	/// <param name="count">number of frequencies on list</param>
+	void begin(const uint16_t* frequencies, const uint8_t& count);
+
+	/// <summary>
+	/// Starts survey of frequencies from given range. Audio is muted during survey. Pass values without decimal place, ex: 919 is 91.9Mhz.
+	/// </summary>
+	/// <param name="from">first frequency</param>
+	/// <param name="to">last frequency</param>
+	/// <param name="step">step between frequencies, ex: 1 is 100kHz</param>
+	void begin(const uint16_t& from, const uint16_t& to, const uint16_t& step = 1);
+
+	/// <summary>
+	/// Stops survey and restores mute state. Tune receiver to desired frequency after that.
+	/// </summary>
+	void end(void);
+
+	/// <summary>
+	/// Performs next step of survey. It never waits for receiver, so call it as often as possible, for example in main loop.
+	/// Channels are visited in round robin. Receiver leaves channel when signal is weak, there is no RDS, or when PI and PS are complete.
+	/// If station is already known with complete PS, only its PI is confirmed.
+	/// </summary>
+	/// <returns>true if station database was updated during this call, false otherwise</returns>
+	bool update(void);
+
+	/// <summary>
+	/// Sets minimal signal level of surveyed channels.
+	/// </summary>
+	/// <param name="minRssi">RSSI below which channel is skipped without waiting for RDS</param>
+	void setMinRssi(const uint8_t& minRssi) { m_settings.minRssi = minRssi; }
+
+	/// <summary>
+	/// Sets how long receiver can stay on one channel.
+	/// </summary>
+	/// <param name="settleTime">time in ms to wait after frequency change before signal is measured</param>
+	/// <param name="syncTimeout">max time in ms to wait for RDS synchronization</param>
+	/// <param name="piTimeout">max time in ms to wait for confirmed PI</param>
+	/// <param name="maxDwell">max time in ms spent on one channel</param>
+	void setDwellTimes(const uint16_t& settleTime, const uint16_t& syncTimeout = 250, const uint16_t& piTimeout = 600, const uint16_t& maxDwell = 2500)
+	{
+		m_settings.settleTime = settleTime;
+		m_settings.syncTimeout = syncTimeout;
+		m_settings.piTimeout = piTimeout;
+		m_settings.maxDwell = maxDwell;
+	}
+
+	/// <summary>
+	/// Returns information if survey is running.
+	/// </summary>
+	/// <returns>true if survey is running, false otherwise</returns>
+	bool getRunning(void) const { return m_state != state::disabled; }
+
+	/// <summary>
+	/// Returns frequency which is currently visited.
+	/// </summary>
+	/// <returns>frequency value, ex: 919 is 91.9Mhz</returns>
+	uint16_t getCurrentFrequency(void) const { return m_frequency; }
+
+	/// <summary>
+	/// Returns statistics of survey.
+	/// </summary>
+	/// <returns>survey statistics</returns>
+	const surveyStats& getStats(void) const { return m_stats; }
+
+	/// <summary>
+	/// Returns number of stations added to database per minute since survey was started.
+	/// </summary>
+	/// <returns>stations per minute</returns>
+	float getStationsPerMinute(void) const;
+
+	/// <summary>
+	/// Returns I2C bus load caused by receiver since survey was started.
+	/// </summary>
+	/// <returns>number of transferred bytes per second</returns>
+	uint32_t getBusLoad(void) const;
+
+private:
+	/// <summary>
+	/// Resets statistics, mutes audio and tunes receiver to first channel.
+	/// </summary>
+	void start(void);
+
+	/// <summary>
+	/// Waits until receiver is tuned and skips channel if signal is too weak.
+	/// </summary>
+	void updateSettling(void);
+
+	/// <summary>
+	/// Decodes RDS data of visited channel until station is identified or time is up.
+	/// </summary>
+	/// <returns>true if station database was updated, false otherwise</returns>
+	bool updateCollecting(void);
+
+	/// <summary>
+	/// Tunes receiver to next channel from list, or to the first one when round is completed.
+	/// </summary>
+	void startNextChannel(void);
+
+	/// <summary>
+	/// Returns frequency of channel with given index.
+	/// </summary>
+	/// <param name="index">index of channel</param>
+	/// <returns>frequency value</returns>
+	uint16_t getChannelFrequency(const uint16_t& index) const { return (m_frequencies != nullptr) ? m_frequencies[index] : static_cast<uint16_t>(m_firstFrequency + (index * m_frequencyStep)); }
+
+	/// <summary>
+	/// Writes data decoded on visited channel to station database.
+	/// </summary>
+	/// <param name="rds">decoded RDS data</param>
+	void updateDatabase(const RdsDecoder& rds);
+};
+
+#endif
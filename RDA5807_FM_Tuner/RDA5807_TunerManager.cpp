@@ -0,0 +1,131 @@
+/*
+ Name:		RDA5807_TunerManager.cpp
+ Created:	18/10/2026 5:02:46 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "RDA5807_TunerManager.h"
+
+uint8_t RDA5807_TunerManager::addTuner(RDA5807& receiver, const uint8_t& channel)
+{
+	if (m_tunerCount >= RDA5807_MANAGER_TUNER_COUNT || channel > 7) return 0xFF;
+
+	tuner& entry = m_tuners[m_tunerCount];
+	memset(&entry, 0, sizeof(tuner));
+	entry.receiver = &receiver;
+	entry.channel = channel;
+	entry.i2cHealthAtStart = receiver.getI2cHealth();
+	receiver.setI2cBus(m_wire, selectReceiver, this);
+	if (!m_tunerCount) m_statsStart = millis();
+	return m_tunerCount++;
+}
+
+uint8_t RDA5807_TunerManager::update(void)
+{
+	for (uint8_t i = 0; i < m_tunerCount; i++)
+	{
+		const uint8_t index = m_nextTuner;
+		tuner& entry = m_tuners[index];
+		RDA5807& receiver = *entry.receiver;
+
+		if (++m_nextTuner >= m_tunerCount) m_nextTuner = 0;
+		if (!entry.pendingFrequency && !entry.pendingCommit && receiver.getDecodedRdsData() == nullptr) continue;//nothing to do with this receiver
+
+		m_stats.turns++;
+		if (entry.pendingCommit || entry.pendingFrequency)
+		{//all queued operations are done in one turn, so multiplexer is switched only once
+			if (entry.pendingCommit && receiver.writeSettingsToReceiver())
+			{
+				entry.pendingCommit = false;
+				entry.stats.commits++;
+			}
+			if (entry.pendingFrequency && receiver.startFrequencyChange(entry.pendingFrequency))
+			{
+				entry.pendingFrequency = 0;
+				entry.stats.tunes++;
+			}
+			return index;
+		}
+
+		entry.stats.rdsPolls++;
+		if (receiver.checkIfNewRdsDataIsReady() && receiver.updateRdsData())
+		{
+			receiver.updateDecodedRdsData();
+			entry.stats.rdsGroups++;
+		}
+		return index;
+	}
+	return 0xFF;
+}
+
+bool RDA5807_TunerManager::selectTuner(const uint8_t& index)
+{
+	if (index >= m_tunerCount) return false;
+
+	tuner& entry = m_tuners[index];
+	if (m_selectedChannel == entry.channel)
+	{
+		m_stats.skippedMuxSwitches++;
+		return true;
+	}
+
+	m_wire.beginTransmission(m_muxAddress);
+	m_wire.write(static_cast<uint8_t>(1 << entry.channel));
+	m_stats.muxSwitches++;
+	entry.stats.muxSwitches++;
+	if (m_wire.endTransmission() != 0)
+	{
+		m_stats.muxFailures++;
+		m_selectedChannel = 0xFF;//state of multiplexer is unknown
+		return false;
+	}
+	m_selectedChannel = entry.channel;
+	return true;
+}
+
+RDA5807_TunerManager::tunerStats RDA5807_TunerManager::getTunerStats(const uint8_t& index) const
+{
+	tunerStats stats = { 0 };
+
+	if (index >= m_tunerCount) return stats;
+	const tuner& entry = m_tuners[index];
+	stats = entry.stats;
+	stats.transactions = entry.receiver->getI2cHealth().transactions - entry.i2cHealthAtStart.transactions + entry.stats.muxSwitches;
+	stats.bytesTransferred = entry.receiver->getI2cHealth().bytesTransferred - entry.i2cHealthAtStart.bytesTransferred + entry.stats.muxSwitches;//one byte for every write to multiplexer
+	return stats;
+}
+
+uint32_t RDA5807_TunerManager::getTunerBusLoad(const uint8_t& index) const
+{
+	const unsigned long time = millis() - m_statsStart;
+
+	if (!time) return 0;
+	return static_cast<uint32_t>((getTunerStats(index).bytesTransferred * 1000ULL) / time);
+}
+
+void RDA5807_TunerManager::resetStats(void)
+{
+	for (uint8_t i = 0; i < m_tunerCount; i++)
+	{
+		memset(&m_tuners[i].stats, 0, sizeof(tunerStats));
+		m_tuners[i].i2cHealthAtStart = m_tuners[i].receiver->getI2cHealth();
+	}
+	m_stats = { 0 };
+	m_statsStart = millis();
+}
+
+bool RDA5807_TunerManager::selectReceiver(void* context, const RDA5807& receiver)
+{
+	RDA5807_TunerManager* const manager = static_cast<RDA5807_TunerManager*>(context);
+
+	return manager->selectTuner(manager->findTuner(receiver));
+}
+
+uint8_t RDA5807_TunerManager::findTuner(const RDA5807& receiver) const
+{
+	for (uint8_t i = 0; i < m_tunerCount; i++)
+		if (m_tuners[i].receiver == &receiver) return i;
+	return 0xFF;
+}
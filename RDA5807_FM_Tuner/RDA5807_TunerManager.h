@@ -0,0 +1,193 @@
+/*
+ Name:		RDA5807_TunerManager.h
+ Created:	18/10/2026 5:02:46 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _RDA5807_TUNERMANAGER_h
+#define _RDA5807_TUNERMANAGER_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "RDA5807_FM_Tuner.h"
+
+#ifndef RDA5807_MANAGER_TUNER_COUNT
+#define RDA5807_MANAGER_TUNER_COUNT 4//max number of receivers handled by one manager
+#endif
+
+class RDA5807_TunerManager final
+{
+public:
+	/// <summary>
+	/// Bus usage statistics of one receiver.
+	/// </summary>
+	struct tunerStats
+	{
+		uint32_t transactions;//number of transactions sent to receiver and to multiplexer on its behalf
+		uint32_t bytesTransferred;//number of bytes transferred to receiver and to multiplexer on its behalf
+		uint16_t muxSwitches;//number of times when multiplexer was switched to channel of receiver
+		uint16_t rdsPolls;//number of times when receiver was checked for new RDS group
+		uint16_t rdsGroups;//number of read RDS groups
+		uint16_t tunes;//number of started queued frequency changes
+		uint16_t commits;//number of written queued settings
+	};
+
+	/// <summary>
+	/// Statistics of manager.
+	/// </summary>
+	struct managerStats
+	{
+		uint32_t turns;//number of turns in which some receiver used the bus
+		uint32_t muxSwitches;//number of writes to multiplexer
+		uint32_t skippedMuxSwitches;//number of writes to multiplexer which were skipped because channel was already selected
+		uint16_t muxFailures;//number of failed writes to multiplexer
+	};
+
+private:
+	/// <summary>
+	/// Receiver handled by manager.
+	/// </summary>
+	struct tuner
+	{
+		RDA5807* receiver;
+		uint8_t channel;//channel of multiplexer, from 0 to 7
+		uint16_t pendingFrequency;//frequency to set in next turn, 0 if none
+		bool pendingCommit;//true if settings have to be written in next turn
+		tunerStats stats;//statistics of multiplexer, transactions and bytes of receiver are read from its health record
+		RDA5807::i2cHealth i2cHealthAtStart;//health record of receiver when statistics were reset
+	};
+
+	TwoWire& m_wire;
+	const uint8_t m_muxAddress;
+	tuner m_tuners[RDA5807_MANAGER_TUNER_COUNT];
+	uint8_t m_tunerCount = 0;
+	uint8_t m_nextTuner = 0;//index of receiver which will use the bus in next turn
+	uint8_t m_selectedChannel = 0xFF;//channel currently selected in multiplexer, 0xFF if unknown
+	unsigned long m_statsStart = 0;
+	managerStats m_stats = { 0 };
+
+public:
+	/// <summary>
+	/// Creates manager of receivers connected to channels of TCA9548A or compatible I2C multiplexer.
+	/// </summary>
+	/// <param name="wire">I2C bus on which multiplexer is connected</param>
+	/// <param name="muxAddress">address of multiplexer, from 0x70 to 0x77</param>
+	RDA5807_TunerManager(TwoWire& wire = Wire, const uint8_t& muxAddress = 0x70) : m_wire(wire), m_muxAddress(muxAddress) {}
+
+	RDA5807_TunerManager(const RDA5807_TunerManager&) = delete;
+	RDA5807_TunerManager& operator=(const RDA5807_TunerManager&) = delete;
+
+	/// <summary>
+	/// Adds receiver connected to given channel of multiplexer. From now on multiplexer is switched automatically before every transaction of this receiver,
+	/// also the ones started directly by application.
+	/// </summary>
+	/// <param name="receiver">receiver to add, it has to exist as long as manager</param>
+	/// <param name="channel">channel of multiplexer, from 0 to 7</param>
+	/// <returns>index of receiver in manager, 0xFF if there is no space for it or channel is invalid</returns>
+	uint8_t addTuner(RDA5807& receiver, const uint8_t& channel);
+
+	/// <summary>
+	/// Returns number of receivers added to manager.
+	/// </summary>
+	/// <returns>number of receivers</returns>
+	uint8_t getTunerCount(void) const { return m_tunerCount; }
+
+	/// <summary>
+	/// Returns receiver with given index.
+	/// </summary>
+	/// <param name="index">index of receiver returned by addTuner()</param>
+	/// <returns>pointer to receiver, nullptr if index is out of range</returns>
+	RDA5807* getTuner(const uint8_t& index) const { return (index < m_tunerCount) ? m_tuners[index].receiver : nullptr; }
+
+	/// <summary>
+	/// Queues frequency change, which will be started in next turn of receiver. Only last queued frequency is set.
+	/// Pass value without decimal place, ex: 919 is 91.9Mhz.
+	/// </summary>
+	/// <param name="index">index of receiver</param>
+	/// <param name="freq">frequency to set</param>
+	void queueTune(const uint8_t& index, const uint16_t& freq) { if (index < m_tunerCount) m_tuners[index].pendingFrequency = freq; }
+
+	/// <summary>
+	/// Queues writing of settings, which will be done in next turn of receiver. Change any number of settings locally first,
+	/// they will be written together with one transaction.
+	/// </summary>
+	/// <param name="index">index of receiver</param>
+	void queueCommit(const uint8_t& index) { if (index < m_tunerCount) m_tuners[index].pendingCommit = true; }
+
+	/// <summary>
+	/// Returns information if receiver has queued operations.
+	/// </summary>
+	/// <param name="index">index of receiver</param>
+	/// <returns>true if frequency change or writing of settings is queued, false otherwise</returns>
+	bool getPending(const uint8_t& index) const { return (index < m_tunerCount) && (m_tuners[index].pendingFrequency || m_tuners[index].pendingCommit); }
+
+	/// <summary>
+	/// Performs one turn. Receivers use the bus in round robin, one receiver per call. In its turn receiver writes queued settings
+	/// and starts queued frequency change, or if nothing is queued, it is checked for new RDS group which is then read and decoded.
+	/// Receivers without queued operations and without RDS decoder are skipped. Call it as often as possible, for example in main loop.
+	/// </summary>
+	/// <returns>index of receiver which used the bus, 0xFF if none</returns>
+	uint8_t update(void);
+
+	/// <summary>
+	/// Selects channel of given receiver in multiplexer. Write to multiplexer is skipped if channel is already selected.
+	/// </summary>
+	/// <param name="index">index of receiver</param>
+	/// <returns>true if channel is selected, false otherwise</returns>
+	bool selectTuner(const uint8_t& index);
+
+	/// <summary>
+	/// Forgets which channel is selected in multiplexer, so it will be written before next transaction.
+	/// Call it when multiplexer could be reset or used by other code.
+	/// </summary>
+	void invalidateMuxState(void) { m_selectedChannel = 0xFF; }
+
+	/// <summary>
+	/// Returns bus usage statistics of receiver since statistics were reset.
+	/// </summary>
+	/// <param name="index">index of receiver</param>
+	/// <returns>receiver statistics, all values are 0 if index is out of range</returns>
+	tunerStats getTunerStats(const uint8_t& index) const;
+
+	/// <summary>
+	/// Returns bus load caused by receiver since statistics were reset.
+	/// </summary>
+	/// <param name="index">index of receiver</param>
+	/// <returns>number of transferred bytes per second</returns>
+	uint32_t getTunerBusLoad(const uint8_t& index) const;
+
+	/// <summary>
+	/// Returns statistics of manager.
+	/// </summary>
+	/// <returns>manager statistics</returns>
+	const managerStats& getStats(void) const { return m_stats; }
+
+	/// <summary>
+	/// Clears statistics of manager and of all receivers.
+	/// </summary>
+	void resetStats(void);
+
+private:
+	/// <summary>
+	/// Bus selector set in all added receivers.
+	/// </summary>
+	/// <param name="context">pointer to manager</param>
+	/// <param name="receiver">receiver which will start transaction</param>
+	/// <returns>true if channel of receiver is selected, false otherwise</returns>
+	static bool selectReceiver(void* context, const RDA5807& receiver);
+
+	/// <summary>
+	/// Returns index of given receiver.
+	/// </summary>
+	/// <param name="receiver">receiver</param>
+	/// <returns>index of receiver, 0xFF if it wasn't added</returns>
+	uint8_t findTuner(const RDA5807& receiver) const;
+};
+
+#endif
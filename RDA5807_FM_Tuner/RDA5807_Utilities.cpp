@@ -8,6 +8,74 @@
 
 #include "RDA5807_Utilities.h"
 
+/// <summary>
+/// Unicode code points of RDS G0 character set (EN 50067 annex E), 0 for control and unused codes.
+/// </summary>
+static const uint16_t rdsG0CharacterSet[256] PROGMEM =
+{
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x000A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,//0x00
+	0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,//0x10
+	0x0020, 0x0021, 0x0022, 0x0023, 0x00A4, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,//0x20
+	0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,//0x30
+	0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,//0x40
+	0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x2015, 0x005F,//0x50
+	0x2016, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,//0x60
+	0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x00AF, 0x0000,//0x70
+	0x00E1, 0x00E0, 0x00E9, 0x00E8, 0x00ED, 0x00EC, 0x00F3, 0x00F2, 0x00FA, 0x00F9, 0x00D1, 0x00C7, 0x015E, 0x00DF, 0x00A1, 0x0132,//0x80
+	0x00E2, 0x00E4, 0x00EA, 0x00EB, 0x00EE, 0x00EF, 0x00F4, 0x00F6, 0x00FB, 0x00FC, 0x00F1, 0x00E7, 0x015F, 0x011F, 0x0131, 0x0133,//0x90
+	0x00AA, 0x03B1, 0x00A9, 0x2030, 0x011E, 0x011B, 0x0148, 0x0151, 0x03C0, 0x20AC, 0x00A3, 0x0024, 0x2190, 0x2191, 0x2192, 0x2193,//0xA0
+	0x00BA, 0x00B9, 0x00B2, 0x00B3, 0x00B1, 0x0130, 0x0144, 0x0171, 0x00B5, 0x00BF, 0x00F7, 0x00B0, 0x00BC, 0x00BD, 0x00BE, 0x00A7,//0xB0
+	0x00C1, 0x00C0, 0x00C9, 0x00C8, 0x00CD, 0x00CC, 0x00D3, 0x00D2, 0x00DA, 0x00D9, 0x0158, 0x010C, 0x0160, 0x017D, 0x0110, 0x013F,//0xC0
+	0x00C2, 0x00C4, 0x00CA, 0x00CB, 0x00CE, 0x00CF, 0x00D4, 0x00D6, 0x00DB, 0x00DC, 0x0159, 0x010D, 0x0161, 0x017E, 0x0111, 0x0140,//0xD0
+	0x00C3, 0x00C5, 0x00C6, 0x0152, 0x0177, 0x00DD, 0x00D5, 0x00D8, 0x00DE, 0x014A, 0x0154, 0x0106, 0x015A, 0x0179, 0x0166, 0x00F0,//0xE0
+	0x00E3, 0x00E5, 0x00E6, 0x0153, 0x0175, 0x00FD, 0x00F5, 0x00F8, 0x00FE, 0x014B, 0x0155, 0x0107, 0x015B, 0x017A, 0x0167, 0x0000//0xF0
+};
+
+/// <summary>
+/// 8 char labels of RDS (PTY) Programme Types.
+/// </summary>
+static const char rdsProgrammeTypeLabels[32][9] PROGMEM =
+{
+	"None", "News", "Affairs", "Info", "Sport", "Educate", "Drama", "Culture",
+	"Science", "Varied", "Pop M", "Rock M", "Easy M", "Light M", "Classics", "Other M",
+	"Weather", "Finance", "Children", "Social", "Religion", "Phone In", "Travel", "Leisure",
+	"Jazz", "Country", "Nation M", "Oldies", "Folk M", "Document", "TEST", "Alarm !"
+};
+
+/// <summary>
+/// 8 char labels of RBDS (PTY) Programme Types.
+/// </summary>
+static const char rbdsProgrammeTypeLabels[32][9] PROGMEM =
+{
+	"None", "News", "Inform", "Sports", "Talk", "Rock", "Cls Rock", "Adlt Hit",
+	"Soft Rck", "Top 40", "Country", "Oldies", "Soft", "Nostalga", "Jazz", "Classicl",
+	"R & B", "Soft R&B", "Language", "Rel Musc", "Rel Talk", "Persnlty", "Public", "College",
+	"Spn Talk", "Spn Musc", "Hip Hop", "None", "None", "Weather", "Test", "ALERT !"
+};
+
+/// <summary>
+/// PI code and call sign of RBDS stations with three letter call signs, sorted by PI code.
+/// </summary>
+static const struct
+{
+	uint16_t pi;
+	char callSign[4];
+} rbdsThreeLetterCallSigns[70] PROGMEM =
+{
+	{ 0x9950, "KEX" }, { 0x9951, "KFH" }, { 0x9952, "KFI" }, { 0x9953, "KGA" }, { 0x9954, "KGW" }, { 0x9955, "KGY" },
+	{ 0x9956, "KHQ" }, { 0x9957, "KID" }, { 0x9958, "KIT" }, { 0x9959, "KJR" }, { 0x995A, "KLO" }, { 0x995B, "KLZ" },
+	{ 0x995C, "KMA" }, { 0x995D, "KMJ" }, { 0x995E, "KNX" }, { 0x995F, "KOA" }, { 0x9960, "KOY" }, { 0x9961, "KPQ" },
+	{ 0x9962, "KQV" }, { 0x9963, "KSD" }, { 0x9964, "KSL" }, { 0x9965, "KUJ" }, { 0x9966, "KUT" }, { 0x9967, "KVI" },
+	{ 0x9968, "KWG" }, { 0x9969, "KXL" }, { 0x996A, "KXO" }, { 0x996B, "KYW" }, { 0x996C, "WBZ" }, { 0x996D, "WDZ" },
+	{ 0x996E, "WEW" }, { 0x996F, "WGL" }, { 0x9970, "WGN" }, { 0x9971, "WGR" }, { 0x9972, "WGY" }, { 0x9973, "WHA" },
+	{ 0x9974, "WHB" }, { 0x9975, "WHK" }, { 0x9976, "WHO" }, { 0x9977, "WHP" }, { 0x9978, "WIL" }, { 0x9979, "WIP" },
+	{ 0x997A, "WIS" }, { 0x997B, "WJR" }, { 0x997C, "WJW" }, { 0x997D, "WJZ" }, { 0x997E, "WKY" }, { 0x997F, "WLS" },
+	{ 0x9980, "WLW" }, { 0x9981, "WMC" }, { 0x9982, "WMT" }, { 0x9983, "WOC" }, { 0x9984, "WOI" }, { 0x9985, "WOL" },
+	{ 0x9986, "WOR" }, { 0x9987, "WOW" }, { 0x9988, "WRC" }, { 0x9989, "WRR" }, { 0x998A, "WSB" }, { 0x998B, "WSM" },
+	{ 0x998C, "WWJ" }, { 0x998D, "WWL" }, { 0x9990, "KDB" }, { 0x9991, "KGB" }, { 0x9992, "WBT" }, { 0x9993, "WGH" },
+	{ 0x99A5, "KBW" }, { 0x99A6, "KCY" }, { 0x99A7, "KDF" }, { 0x99AA, "KOB" }
+};
+
 float RDA5807_Utilities::getFrequencyValue(
 	const uint16_t& freq,
 	const RDA5807::channelSpacing& chanSpac,
@@ -15,40 +83,95 @@ float RDA5807_Utilities::getFrequencyValue(
 	const bool& altEurBand)
 {
 	float band = 0;
-	uint8_t spc = 0;
+	uint8_t spc = getChannelSpacingValue(chanSpac);
 
-	switch (chanSpac)
+	switch (selBand)
 	{
-	case RDA5807::channelSpacing::spc25kHz:
-		spc = 25;
+	case RDA5807::band::usEurope:
+		band = 87.0f;
 		break;
-	case RDA5807::channelSpacing::spc50kHz:
-		spc = 50;
+	case RDA5807::band::japan:
+	case RDA5807::band::worldWide:
+		band = 76.0f;
 		break;
-	case RDA5807::channelSpacing::spc100kHz:
-		spc = 100;
+	case RDA5807::band::eastEurope:
+		if (altEurBand) band = 50.0f;
+		else band = 65.0f;
 		break;
+	}
+
+	return static_cast<float>(((freq * spc) / 1000.0f) + band);
+}
+
+uint8_t RDA5807_Utilities::getChannelSpacingValue(const RDA5807::channelSpacing& chanSpac)
+{
+	switch (chanSpac)
+	{
+	case RDA5807::channelSpacing::spc25kHz:
+		return 25;
+	case RDA5807::channelSpacing::spc50kHz:
+		return 50;
 	case RDA5807::channelSpacing::spc200kHz:
-		spc = 200;
-		break;
+		return 200;
+	default:
+		return 100;
 	}
+}
 
+void RDA5807_Utilities::getBandLimits(
+	uint16_t& first,
+	uint16_t& last,
+	const RDA5807::band& selBand,
+	const bool& altEurBand)
+{
 	switch (selBand)
 	{
 	case RDA5807::band::usEurope:
-		band = 87.0f;
+		first = 870;
+		last = 1080;
 		break;
 	case RDA5807::band::japan:
+		first = 760;
+		last = 910;
+		break;
 	case RDA5807::band::worldWide:
-		band = 76.0f;
+		first = 760;
+		last = 1080;
 		break;
 	case RDA5807::band::eastEurope:
-		if (altEurBand) band = 50.0f;
-		else band = 65.0f;
+		if (altEurBand) { first = 500; last = 760; }
+		else { first = 650; last = 760; }
 		break;
 	}
+}
 
-	return static_cast<float>(((freq * spc) / 1000.0f) + band);
+bool RDA5807_Utilities::getFrequencyOffset(
+	const uint16_t& freq,
+	uint16_t& offset,
+	const RDA5807::band& selBand,
+	const bool& altEurBand)
+{
+	uint16_t bandStart = 0;
+	uint16_t bandEnd = 0;
+
+	getBandLimits(bandStart, bandEnd, selBand, altEurBand);
+	if (freq < bandStart || freq > bandEnd) return false;//freq value can't be set outside selected band
+	offset = static_cast<uint16_t>((freq - bandStart) * 100);
+	return true;
+}
+
+bool RDA5807_Utilities::getChannelValue(
+	const uint16_t& freq,
+	uint16_t& channel,
+	const RDA5807::channelSpacing& chanSpac,
+	const RDA5807::band& selBand,
+	const bool& altEurBand)
+{
+	uint16_t offset = 0;
+
+	if (!getFrequencyOffset(freq, offset, selBand, altEurBand)) return false;
+	channel = offset / getChannelSpacingValue(chanSpac);
+	return true;
 }
 
 float RDA5807_Utilities::getAlternativeFrequencyValue(
@@ -75,3 +198,102 @@ float RDA5807_Utilities::getAlternativeFrequencyValue(
 
 	return static_cast<float>((freq / 1000.0f) + band);
 }
+
+uint16_t RDA5807_Utilities::convertRdsCharToUnicode(const char& rdsChar, const rdsCharacterSet& characterSet)
+{
+	const uint8_t code = static_cast<uint8_t>(rdsChar);
+
+	if (code >= 0x80 && characterSet != rdsCharacterSet::g0) return 0x003F;//upper halves of G1 and G2 are not supported, lower halves are the same as in G0
+	return pgm_read_word(&rdsG0CharacterSet[code]);
+}
+
+uint8_t RDA5807_Utilities::convertRdsCharToUtf8(const char& rdsChar, char* destination, const rdsCharacterSet& characterSet)
+{
+	const uint16_t codePoint = convertRdsCharToUnicode(rdsChar, characterSet);
+
+	if (!codePoint) return 0;
+	if (codePoint < 0x80)
+	{
+		destination[0] = static_cast<char>(codePoint);
+		return 1;
+	}
+	if (codePoint < 0x800)
+	{
+		destination[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+		destination[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+		return 2;
+	}
+	destination[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+	destination[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+	destination[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+	return 3;
+}
+
+size_t RDA5807_Utilities::convertRdsTextToUtf8(const char* text, const uint8_t& length, char* destination, const size_t& size, const rdsCharacterSet& characterSet)
+{
+	size_t position = 0;
+	char utf8Char[3];
+
+	if (!size) return 0;
+	for (uint8_t i = 0; i < length && text[i]; i++)
+	{
+		if (static_cast<uint8_t>(text[i]) >= 0x20 && static_cast<uint8_t>(text[i]) < 0x7E &&
+			text[i] != 0x24 && text[i] != 0x5E && text[i] != 0x60)
+		{//most chars are the same as in ASCII, so copy them without table lookup
+			if ((position + 1) >= size) break;
+			destination[position++] = text[i];
+			continue;
+		}
+
+		const uint8_t utf8Length = convertRdsCharToUtf8(text[i], utf8Char, characterSet);
+		if ((position + utf8Length) >= size) break;//don't write incomplete char
+		memcpy(&destination[position], utf8Char, utf8Length);
+		position += utf8Length;
+	}
+	destination[position] = 0;
+	return position;
+}
+
+void RDA5807_Utilities::getProgrammeTypeLabel(const uint8_t& programmeType, const bool& rbds, char* destination)
+{
+	destination[0] = 0;
+	if (programmeType >= 32) return;
+	strncpy_P(destination, rbds ? rbdsProgrammeTypeLabels[programmeType] : rdsProgrammeTypeLabels[programmeType], 9);
+}
+
+bool RDA5807_Utilities::convertPiToCallSign(const uint16_t& programmeIdentification, char* destination)
+{
+	uint16_t pi = programmeIdentification;
+
+	destination[0] = 0;
+	if ((pi & 0xFF00) == 0xAF00) pi = static_cast<uint16_t>(pi << 8);//AFxy is xy00
+	else if ((pi & 0xF000) == 0xA000) pi = static_cast<uint16_t>(((pi & 0x0F00) << 4) | (pi & 0x00FF));//Axyz is x0yz
+
+	if (pi > 0x994F && pi < 0x99BA)
+	{//three letter call signs are taken from table, codes without entry are not assigned
+		for (uint8_t i = 0; i < (sizeof(rbdsThreeLetterCallSigns) / sizeof(rbdsThreeLetterCallSigns[0])); i++)
+		{
+			if (pgm_read_word(&rbdsThreeLetterCallSigns[i].pi) != pi) continue;
+			strncpy_P(destination, rbdsThreeLetterCallSigns[i].callSign, 4);
+			return true;
+		}
+		return false;
+	}
+	if (pi < 0x1000 || pi > 0x994F) return false;//not a call sign, ex: nationally or regionally linked network
+
+	if (pi >= 0x54A8)
+	{
+		destination[0] = 'W';
+		pi -= 0x54A8;
+	}
+	else
+	{
+		destination[0] = 'K';
+		pi -= 0x1000;
+	}
+	destination[1] = static_cast<char>('A' + (pi / 676));
+	destination[2] = static_cast<char>('A' + ((pi % 676) / 26));
+	destination[3] = static_cast<char>('A' + (pi % 26));
+	destination[4] = 0;
+	return true;
+}
@@ -25,6 +25,12 @@ private:
 	RDA5807_Utilities& operator=(const RDA5807_Utilities&) = delete;
 
 public:
+	/// <summary>
+	/// Possible RDS character sets. G0 is used by default, broadcaster can switch to G1 or G2 with escape sequence sent in text.
+	/// Only G0 is fully supported, chars from upper half of G1 and G2 are converted to '?'.
+	/// </summary>
+	enum class rdsCharacterSet : uint8_t { g0, g1, g2 };
+
 	/// <summary>
 	/// Returns current volume level converted to percentage level.
 	/// </summary>
@@ -60,6 +66,57 @@ public:
 		const RDA5807::band& selBand = RDA5807::band::usEurope,
 		const bool& altEurBand = false);
 
+	/// <summary>
+	/// Returns channel spacing value in kHz.
+	/// </summary>
+	/// <param name="chanSpac">channel spacing</param>
+	/// <returns>channel spacing value in kHz</returns>
+	static uint8_t getChannelSpacingValue(const RDA5807::channelSpacing& chanSpac);
+
+	/// <summary>
+	/// Returns first and last frequency of selected band. Values are without decimal place, ex: 919 is 91.9Mhz.
+	/// </summary>
+	/// <param name="first">destination for first frequency</param>
+	/// <param name="last">destination for last frequency</param>
+	/// <param name="selBand">selected band</param>
+	/// <param name="altEurBand">information if alternative East Europe band was selected</param>
+	static void getBandLimits(
+		uint16_t& first,
+		uint16_t& last,
+		const RDA5807::band& selBand = RDA5807::band::usEurope,
+		const bool& altEurBand = false);
+
+	/// <summary>
+	/// Returns offset of frequency from the beginning of selected band. Offset is used as value for alternative frequency setting mode.
+	/// Pass frequency value without decimal place, ex: 919 is 91.9Mhz.
+	/// </summary>
+	/// <param name="freq">frequency value</param>
+	/// <param name="offset">destination for offset value in kHz</param>
+	/// <param name="selBand">selected band</param>
+	/// <param name="altEurBand">information if alternative East Europe band was selected</param>
+	/// <returns>true if frequency is inside selected band, false otherwise</returns>
+	static bool getFrequencyOffset(
+		const uint16_t& freq,
+		uint16_t& offset,
+		const RDA5807::band& selBand = RDA5807::band::usEurope,
+		const bool& altEurBand = false);
+
+	/// <summary>
+	/// Returns channel value for given frequency. Pass frequency value without decimal place, ex: 919 is 91.9Mhz.
+	/// </summary>
+	/// <param name="freq">frequency value</param>
+	/// <param name="channel">destination for channel value</param>
+	/// <param name="chanSpac">channel spacing</param>
+	/// <param name="selBand">selected band</param>
+	/// <param name="altEurBand">information if alternative East Europe band was selected</param>
+	/// <returns>true if frequency is inside selected band, false otherwise</returns>
+	static bool getChannelValue(
+		const uint16_t& freq,
+		uint16_t& channel,
+		const RDA5807::channelSpacing& chanSpac = RDA5807::channelSpacing::spc100kHz,
+		const RDA5807::band& selBand = RDA5807::band::usEurope,
+		const bool& altEurBand = false);
+
 	/// <summary>
 	/// Returns current frequency value when using alternative frequency setting mode.
 	/// </summary>
@@ -71,6 +128,53 @@ public:
 		const uint16_t& freq,
 		const RDA5807::band& selBand = RDA5807::band::usEurope,
 		const bool& altEurBand = false);
+
+	/// <summary>
+	/// Returns Unicode code point of char from RDS character set, which is used by PS, RadioText and PTYN.
+	/// </summary>
+	/// <param name="rdsChar">char received in RDS data</param>
+	/// <param name="characterSet">character set selected by broadcaster</param>
+	/// <returns>code point, 0 if char is a control code or is unused, '?' for upper half of G1 and G2</returns>
+	static uint16_t convertRdsCharToUnicode(const char& rdsChar, const rdsCharacterSet& characterSet = rdsCharacterSet::g0);
+
+	/// <summary>
+	/// Encodes char from RDS character set as UTF-8.
+	/// </summary>
+	/// <param name="rdsChar">char received in RDS data</param>
+	/// <param name="destination">buffer for at least 3 bytes</param>
+	/// <param name="characterSet">character set selected by broadcaster</param>
+	/// <returns>number of written bytes, 0 if char is a control code or is unused</returns>
+	static uint8_t convertRdsCharToUtf8(const char& rdsChar, char* destination, const rdsCharacterSet& characterSet = rdsCharacterSet::g0);
+
+	/// <summary>
+	/// Encodes text from RDS character set as UTF-8, ex: getProgrammeServiceName() or getRadioText(). Control codes are skipped.
+	/// Result is always terminated by 0 and chars which don't fit in buffer are not written.
+	/// Buffer of 3 * length + 1 bytes is always big enough.
+	/// </summary>
+	/// <param name="text">text received in RDS data, conversion stops at first 0</param>
+	/// <param name="length">max number of chars to convert</param>
+	/// <param name="destination">destination buffer</param>
+	/// <param name="size">size of destination buffer</param>
+	/// <param name="characterSet">character set selected by broadcaster</param>
+	/// <returns>number of written bytes, without terminating 0</returns>
+	static size_t convertRdsTextToUtf8(const char* text, const uint8_t& length, char* destination, const size_t& size, const rdsCharacterSet& characterSet = rdsCharacterSet::g0);
+
+	/// <summary>
+	/// Copies 8 char label of (PTY) Programme Type code, ex: "Pop M" in RDS or "Top 40" in RBDS.
+	/// Use it with RdsDecoder::getProgrammeTypeCode() and RdsDecoder::getRbdsMode().
+	/// </summary>
+	/// <param name="programmeType">PTY code from 0 to 31</param>
+	/// <param name="rbds">true if RBDS labels have to be used, false if RDS ones</param>
+	/// <param name="destination">buffer for at least 9 chars, label is terminated by 0</param>
+	static void getProgrammeTypeLabel(const uint8_t& programmeType, const bool& rbds, char* destination);
+
+	/// <summary>
+	/// Converts RBDS (PI) Programme Identification code to call sign of north american station, ex: 0x54A8 is "WAAA".
+	/// </summary>
+	/// <param name="programmeIdentification">PI code</param>
+	/// <param name="destination">buffer for at least 5 chars, call sign is terminated by 0</param>
+	/// <returns>true if PI code contains call sign, false otherwise</returns>
+	static bool convertPiToCallSign(const uint16_t& programmeIdentification, char* destination);
 };
 
 #endif
@@ -0,0 +1,100 @@
+/*
+ Name:		RDA5807_VolumeRamp.cpp
+ Created:	19/10/2026 3:52:08 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#include "RDA5807_VolumeRamp.h"
+
+void RDA5807_VolumeRamp::setVolume(const uint8_t& level)
+{
+	m_muteAtEnd = false;
+	startRamp((level > 0x0F) ? 0x0F : level);
+}
+
+void RDA5807_VolumeRamp::fadeOut(void)
+{
+	if (m_muteAtEnd) return;//already fading out, volume to restore is kept
+	m_restoreLevel = m_ramping ? m_target : m_receiver.getVolume();
+	m_muteAtEnd = true;
+	startRamp(0);
+}
+
+bool RDA5807_VolumeRamp::update(void)
+{
+	if (!m_ramping || (millis() - m_lastStep) < m_stepInterval) return false;
+	m_lastStep = millis();
+
+	uint8_t level = m_level;
+	if (m_target > m_level) level = ((m_target - m_level) > m_stepSize) ? static_cast<uint8_t>(m_level + m_stepSize) : m_target;
+	else if (m_target < m_level) level = ((m_level - m_target) > m_stepSize) ? static_cast<uint8_t>(m_level - m_stepSize) : m_target;
+
+	const bool end = (level == m_target);
+	if (!writeVolume(level, end)) return false;//step will be repeated
+	m_level = level;
+	if (!end) return false;
+
+	complete();
+	return true;
+}
+
+void RDA5807_VolumeRamp::startRamp(const uint8_t& target)
+{
+	if (m_ramping) m_stats.coalescedTargets++;
+	else m_level = m_receiver.getVolume();//volume could be changed by other code
+	m_target = target;
+
+	const uint8_t steps = (m_target > m_level) ? (m_target - m_level) : (m_level - m_target);
+	if (!steps && (m_muteAtEnd ? m_receiver.getMute() : !m_mutedByFade))
+	{//nothing to change
+		if (m_ramping) complete();
+		return;
+	}
+	if (!m_ramping)
+	{
+		m_rampWrites = 0;
+		m_stats.ramps++;
+	}
+
+	m_stepSize = 1;
+	m_stepInterval = steps ? (m_settings.rampTime / steps) : 0;
+	if (steps && (!m_stepInterval || m_stepInterval < m_settings.minStepInterval))
+	{//ramp is too short for all steps, so levels are skipped to keep writes at least min interval apart
+		const uint8_t minInterval = m_settings.minStepInterval ? m_settings.minStepInterval : 1;
+		const uint16_t writes = m_settings.rampTime / minInterval;
+
+		m_stepSize = writes ? static_cast<uint8_t>((steps + writes - 1) / writes) : steps;
+		m_stepInterval = writes ? minInterval : 0;
+	}
+	m_lastStep = millis() - m_stepInterval;//first step is made with next update
+	m_ramping = true;
+}
+
+bool RDA5807_VolumeRamp::writeVolume(const uint8_t& level, const bool& lastStep)
+{
+	RDA5807::transaction changes(m_receiver);
+	const bool fadedOut = lastStep && m_muteAtEnd && !m_receiver.getMute();//mute set by application isn't taken over
+
+	m_receiver.setVolume(level);
+	if (fadedOut) m_receiver.setMute(true);
+	else if (!m_muteAtEnd && m_mutedByFade) m_receiver.setMute(false);//first step after fade out
+	if (!changes.commit())
+	{
+		m_stats.failedWrites++;
+		return false;
+	}
+	if (fadedOut) m_mutedByFade = true;
+	else if (!m_muteAtEnd) m_mutedByFade = false;
+	m_stats.writes++;
+	if (m_rampWrites < 0xFF) m_rampWrites++;
+	return true;
+}
+
+void RDA5807_VolumeRamp::complete(void)
+{
+	m_ramping = false;
+	m_stats.lastRampWrites = m_rampWrites;
+	if (m_rampWrites > m_stats.maxRampWrites) m_stats.maxRampWrites = m_rampWrites;
+}
@@ -0,0 +1,151 @@
+/*
+ Name:		RDA5807_VolumeRamp.h
+ Created:	19/10/2026 3:52:08 PM
+ Author:	Wojciech Cybowski (github.com/wcyb)
+ License:	GPL v2
+ Editor:	http://www.visualmicro.com
+*/
+
+#ifndef _RDA5807_VOLUMERAMP_h
+#define _RDA5807_VOLUMERAMP_h
+
+#if defined(ARDUINO) && ARDUINO >= 100
+#include "arduino.h"
+#else
+#include "WProgram.h"
+#endif
+
+#include "RDA5807_FM_Tuner.h"
+
+class RDA5807_VolumeRamp final
+{
+public:
+	/// <summary>
+	/// Statistics of volume ramps.
+	/// </summary>
+	struct rampStats
+	{
+		uint16_t ramps;//number of started ramps, targets changed during ramp aren't counted
+		uint16_t coalescedTargets;//number of targets which replaced target of running ramp
+		uint32_t writes;//number of register writes made by all ramps
+		uint8_t lastRampWrites;//number of register writes made by last completed ramp
+		uint8_t maxRampWrites;//max number of register writes made by one ramp
+		uint16_t failedWrites;//number of writes which failed, they are repeated with next step
+	};
+
+private:
+	RDA5807& m_receiver;
+
+	/// <summary>
+	/// Settings of volume ramp.
+	/// </summary>
+	struct
+	{
+		uint16_t rampTime = 200;//time in ms of one ramp, regardless of number of volume steps
+		uint8_t minStepInterval = 5;//min time in ms between register writes
+	} m_settings;
+
+	bool m_ramping = false;
+	bool m_muteAtEnd = false;//true if receiver has to be muted when volume reaches 0
+	bool m_mutedByFade = false;//true if receiver was muted by fadeOut(), not by application
+	uint8_t m_level = 0;//volume written to receiver
+	uint8_t m_target = 0;
+	uint8_t m_restoreLevel = 0;//volume before fade out
+	uint8_t m_rampWrites = 0;
+	uint16_t m_stepInterval = 0;
+	uint8_t m_stepSize = 1;//number of volume levels changed by one write
+	unsigned long m_lastStep = 0;
+	rampStats m_stats = { 0 };
+
+public:
+	/// <summary>
+	/// Creates engine which changes volume of receiver step by step, so there are no audible jumps.
+	/// Every step writes only register 0x05, so one ramp needs at most 15 writes (plus one for mute).
+	/// </summary>
+	/// <param name="receiver">receiver which volume will be changed</param>
+	RDA5807_VolumeRamp(RDA5807& receiver) : m_receiver(receiver) {}
+
+	RDA5807_VolumeRamp(const RDA5807_VolumeRamp&) = delete;
+	RDA5807_VolumeRamp& operator=(const RDA5807_VolumeRamp&) = delete;
+
+	/// <summary>
+	/// Starts ramp to given volume. If ramp is already running, only its target is changed, so quick changes from UI are merged into one ramp.
+	/// Unmutes receiver only if it was muted by fadeOut(), mute set by application is kept.
+	/// </summary>
+	/// <param name="level">volume level, from 0 to 0x0F</param>
+	void setVolume(const uint8_t& level);
+
+	/// <summary>
+	/// Starts ramp to volume 0 and mutes receiver at the end, use it before frequency change to avoid clicks. Mute state isn't changed during ramp.
+	/// Volume is remembered and restored by fadeIn().
+	/// </summary>
+	void fadeOut(void);
+
+	/// <summary>
+	/// Unmutes receiver and starts ramp to volume which was set before fadeOut().
+	/// </summary>
+	void fadeIn(void) { setVolume(m_restoreLevel); }
+
+	/// <summary>
+	/// Performs next step of ramp if its time has come. Call it as often as possible, for example in main loop or from scheduler.
+	/// </summary>
+	/// <returns>true if ramp was completed during this call, false otherwise</returns>
+	bool update(void);
+
+	/// <summary>
+	/// Sets time of ramp.
+	/// </summary>
+	/// <param name="rampTime">time in ms of one ramp, regardless of number of volume steps, 0 to change volume with one write</param>
+	/// <param name="minStepInterval">min time in ms between register writes, steps are skipped if ramp is too short for all of them</param>
+	void setRampTime(const uint16_t& rampTime, const uint8_t& minStepInterval = 5)
+	{
+		m_settings.rampTime = rampTime;
+		m_settings.minStepInterval = minStepInterval;
+	}
+
+	/// <summary>
+	/// Returns information if ramp is running.
+	/// </summary>
+	/// <returns>true if volume is being changed, false otherwise</returns>
+	bool getRamping(void) const { return m_ramping; }
+
+	/// <summary>
+	/// Returns information if fade out was completed, so frequency can be changed without clicks.
+	/// </summary>
+	/// <returns>true if receiver was muted by fadeOut(), false otherwise</returns>
+	bool getFadedOut(void) const { return !m_ramping && m_muteAtEnd; }
+
+	/// <summary>
+	/// Returns volume which will be set at the end of ramp.
+	/// </summary>
+	/// <returns>volume level, from 0 to 0x0F</returns>
+	uint8_t getTargetVolume(void) const { return m_target; }
+
+	/// <summary>
+	/// Returns statistics of volume ramps.
+	/// </summary>
+	/// <returns>ramp statistics</returns>
+	const rampStats& getStats(void) const { return m_stats; }
+
+private:
+	/// <summary>
+	/// Starts ramp to target or changes target of running one.
+	/// </summary>
+	/// <param name="target">volume level, from 0 to 0x0F</param>
+	void startRamp(const uint8_t& target);
+
+	/// <summary>
+	/// Writes volume to receiver. Mute state is changed only on last step of fadeOut() and first step after it.
+	/// </summary>
+	/// <param name="level">volume level</param>
+	/// <param name="lastStep">true if it is last step of ramp</param>
+	/// <returns>true if settings were written, false otherwise</returns>
+	bool writeVolume(const uint8_t& level, const bool& lastStep);
+
+	/// <summary>
+	/// Ends ramp and updates statistics.
+	/// </summary>
+	void complete(void);
+};
+
+#endif
@@ -10,16 +10,27 @@
 
 RdsDecoder::groupType RdsDecoder::decodeReceivedData(void)
 {
+	const groupType type = getGroupTypeCode();
+
 	setCountryCode();
 	setProgrammeAreaCoverage();
 	setProgrammeReferenceNumber();
+	setProgrammeIdentification();
 	setTrafficProgramme();
 	setProgrammeTypeCode();
+	m_otherNetworks.trafficAnnouncementIndex = 0xFF;//events are reported only for last decoded group
 	//above are common to all groups
-	switch (getGroupTypeCode())
+	if (m_openDataApplications.handlerIndices[static_cast<uint8_t>(type)])
+	{//group is assigned to application with registered handler
+		dispatchOpenDataApplication(m_openDataApplications.handlerIndices[static_cast<uint8_t>(type)] - 1, type);
+		return type;
+	}
+
+	switch (type)
 	{
 	case groupType::g0A:
 		setProgrammeServiceName();
+		setAlternativeFrequencies();
 		return groupType::g0A;
 
 	case groupType::g0B:
@@ -46,28 +57,206 @@ RdsDecoder::groupType RdsDecoder::decodeReceivedData(void)
 		setRadioText2B();
 		return groupType::g2B;
 
+	case groupType::g3A:
+		setOpenDataApplication();
+		return groupType::g3A;
+
 	case groupType::g4A:
 		prepareTimeAndDate();
 		setDate();
 		return groupType::g4A;
 
+	case groupType::g8A:
+		setTrafficMessage();
+		return groupType::g8A;
+
 	case groupType::g10A:
 		setProgrammeTypeName();
 		return groupType::g10A;
+
+	case groupType::g14A:
+		setOtherNetworkInformation();
+		return groupType::g14A;
+
+	case groupType::g14B:
+		setOtherNetworkInformation();
+		return groupType::g14B;
+
+#if RDS_LONG_PS
+	case groupType::g15A:
+		setSegmentedText(m_group15A.text, sizeof(m_group15A.text), m_group15A.receivedSegments, m_group15A.endPosition,
+			static_cast<uint8_t>(*m_rdsDataBlocks.blockB & 0x0007), *m_rdsDataBlocks.blockC, *m_rdsDataBlocks.blockD);
+		return groupType::g15A;
+#endif
+
+	default:
+		return groupType::none;
 	}
 }
 
+void RdsDecoder::clearStationData(void)
+{
+	memset(&m_group0, 0, sizeof(m_group0));
+	memset(&m_altFrequencies, 0, sizeof(m_altFrequencies));
+	memset(&m_group2, 0, sizeof(m_group2));
+	m_radioTextPlus.count = 0;
+	memset(&m_group10A, 0, sizeof(m_group10A));
+#if RDS_LONG_PS
+	memset(&m_group15A, 0, sizeof(m_group15A));
+#endif
+#if RDS_ENHANCED_RADIOTEXT
+	memset(m_enhancedRadioText.text, 0, sizeof(m_enhancedRadioText.text));
+	m_enhancedRadioText.receivedSegments = 0;
+	m_enhancedRadioText.endPosition = 0;
+#endif
+	clearOtherNetworks();
+	clearTrafficMessages();
+	clearOpenDataApplications();
+}
+
+void RdsDecoder::setProgrammeIdentification(void)
+{
+	uint8_t matches = (getVersion() && *m_rdsDataBlocks.blockC == *m_rdsDataBlocks.blockA) ? 2 : 1;
+
+	m_piTracking.confirmedEvent = false;
+	m_piTracking.changedEvent = false;
+	if (*m_rdsDataBlocks.blockA != m_piTracking.code)
+	{//other PI, start counting again
+		m_piTracking.code = *m_rdsDataBlocks.blockA;
+		m_piTracking.matches = 0;
+	}
+	if (m_piTracking.matches >= RDS_PI_CONFIRMATIONS || m_piTracking.code == m_piTracking.confirmedCode) return;//already confirmed
+
+	m_piTracking.matches += matches;
+	if (m_piTracking.matches < RDS_PI_CONFIRMATIONS) return;
+	if (m_piTracking.confirmedCode) m_piTracking.previousConfirmedCode = m_piTracking.confirmedCode;//PI has changed without frequency change
+	m_piTracking.confirmedCode = m_piTracking.code;
+	m_piTracking.confirmTime = millis() - m_piTracking.resetTime;
+	m_piTracking.confirmedEvent = true;
+	m_piTracking.changedEvent = m_piTracking.confirmedCode != m_piTracking.previousConfirmedCode;
+}
+
+void RdsDecoder::resetProgrammeIdentification(const uint16_t& freq)
+{
+	m_tunedFrequencyCode = (freq > 875 && freq < 1080) ? static_cast<uint8_t>(freq - 875) : 0;
+	if (m_piTracking.confirmedCode) m_piTracking.previousConfirmedCode = m_piTracking.confirmedCode;
+	m_piTracking.code = 0;
+	m_piTracking.confirmedCode = 0;
+	m_piTracking.matches = 0;
+	m_piTracking.confirmTime = 0;
+	m_piTracking.resetTime = millis();
+}
+
 void RdsDecoder::setProgrammeServiceName(void)
 {
 	uint8_t segmentAddress = static_cast<uint8_t>(*m_rdsDataBlocks.blockB & 0x0003);
 	if (segmentAddress == 0)
 	{
 		m_group0.decoderControlBits = 0;//reset decoder identification
+		m_group0.receivedSegments = 0;
 		memset(m_group0.programmeServiceName, 0, 9);//reset current content in PS
 	}
+	m_group0.receivedSegments |= static_cast<unsigned short>(1 << segmentAddress);
 	m_group0.programmeServiceName[((segmentAddress + 1) * 2) - 2] = static_cast<char>((*m_rdsDataBlocks.blockD & 0xFF00) >> 8);//get first char
 	m_group0.programmeServiceName[((segmentAddress + 1) * 2) - 1] = static_cast<char>(*m_rdsDataBlocks.blockD & 0x00FF);//get second char
-	m_group0.decoderControlBits |= static_cast<uint8_t>(((*m_rdsDataBlocks.blockB & 0x0004) >> 2) << ~segmentAddress);//get bit of decoder identification and shift it to the right position
+	m_group0.decoderControlBits |= static_cast<uint8_t>(((*m_rdsDataBlocks.blockB & 0x0004) >> 2) << (3 - segmentAddress));//get bit of decoder identification and shift it to the right position, d3 is sent first
+}
+
+bool RdsDecoder::getAlternativeFrequencyListComplete(void) const
+{
+	if (!m_altFrequencies.expectedCount) return false;
+	if (m_altFrequencies.count >= RDS_AF_LIST_SIZE) return true;
+	return (m_altFrequencies.count + (m_altFrequencies.methodB ? 1 : 0)) >= m_altFrequencies.expectedCount;//tuned frequency is counted in method B lists
+}
+
+void RdsDecoder::setAlternativeFrequencies(void)
+{
+	const uint8_t codes[] = { static_cast<uint8_t>((*m_rdsDataBlocks.blockC & 0xFF00) >> 8), static_cast<uint8_t>(*m_rdsDataBlocks.blockC & 0x00FF) };
+
+	if (m_altFrequencies.programmeIdentification != *m_rdsDataBlocks.blockA)
+	{//list belongs to other station, start a new one
+		memset(&m_altFrequencies, 0, sizeof(m_altFrequencies));
+		m_altFrequencies.programmeIdentification = *m_rdsDataBlocks.blockA;
+	}
+
+	if (codes[0] >= 224 && codes[0] <= 249)
+	{//list header, number of frequencies and first frequency
+		if (m_altFrequencies.methodB && m_altFrequencies.headerFrequency != codes[1] &&
+			(codes[1] != m_tunedFrequencyCode || m_altFrequencies.headerFrequency == m_tunedFrequencyCode))
+		{//in method B every transmitter has its own list, keep collected one unless list of received frequency has come
+			m_altFrequencies.skipNextCode = false;
+			return;
+		}
+		if (m_altFrequencies.headerFrequency != codes[1] || m_altFrequencies.expectedCount != codes[0] - 224)
+		{//lists are repeated, so clear only when header is different
+			memset(m_altFrequencies.frequencies, 0, sizeof(m_altFrequencies.frequencies));
+			memset(m_altFrequencies.regionalVariants, 0, sizeof(m_altFrequencies.regionalVariants));
+			m_altFrequencies.count = 0;
+			m_altFrequencies.methodB = false;
+			m_altFrequencies.headerFrequency = codes[1];
+			m_altFrequencies.expectedCount = codes[0] - 224;
+		}
+		m_altFrequencies.skipNextCode = false;
+		if (!m_altFrequencies.methodB) addAlternativeFrequency(codes[1], false);//in method A it is an alternative frequency
+		return;
+	}
+	if (!m_altFrequencies.expectedCount) return;//wait for list header
+
+	if (convertAlternativeFrequencyCode(m_altFrequencies.headerFrequency) && codes[0] != codes[1] &&
+		(codes[0] == m_altFrequencies.headerFrequency || codes[1] == m_altFrequencies.headerFrequency))
+	{//method B, every pair contains tuned frequency, descending order marks regional variant
+		if (!m_altFrequencies.methodB)
+		{
+			m_altFrequencies.methodB = true;
+			removeAlternativeFrequency(m_altFrequencies.headerFrequency);//it was added as alternative frequency when method was unknown
+		}
+		addAlternativeFrequency((codes[0] == m_altFrequencies.headerFrequency) ? codes[1] : codes[0], codes[0] > codes[1]);
+		return;
+	}
+	if (m_altFrequencies.methodB) return;//pair without tuned frequency doesn't belong to this list
+
+	for (uint8_t i = 0; i < 2; i++)
+	{
+		if (m_altFrequencies.skipNextCode) m_altFrequencies.skipNextCode = false;
+		else if (codes[i] == 250) m_altFrequencies.skipNextCode = true;//next code is LF/MF frequency
+		else addAlternativeFrequency(codes[i], false);//filler and not assigned codes are skipped there
+	}
+}
+
+void RdsDecoder::addAlternativeFrequency(const uint8_t& code, const bool& regionalVariant)
+{
+	uint8_t position = 0;
+
+	if (!convertAlternativeFrequencyCode(code)) return;//not a VHF frequency
+	while (position < m_altFrequencies.count && m_altFrequencies.frequencies[position] < code) position++;
+	if (position < m_altFrequencies.count && m_altFrequencies.frequencies[position] == code) return;//already on the list
+	if (m_altFrequencies.count >= RDS_AF_LIST_SIZE) return;//no space left
+
+	for (uint8_t i = m_altFrequencies.count; i > position; i--)
+	{//make space for new frequency
+		m_altFrequencies.frequencies[i] = m_altFrequencies.frequencies[i - 1];
+		setAltFrequencyRegionalFlag(i, getAltFrequencyRegionalFlag(i - 1));
+	}
+	m_altFrequencies.frequencies[position] = code;
+	setAltFrequencyRegionalFlag(position, regionalVariant);
+	m_altFrequencies.count++;
+}
+
+void RdsDecoder::removeAlternativeFrequency(const uint8_t& code)
+{
+	uint8_t position = 0;
+
+	while (position < m_altFrequencies.count && m_altFrequencies.frequencies[position] != code) position++;
+	if (position >= m_altFrequencies.count) return;//not on the list
+
+	m_altFrequencies.count--;
+	for (uint8_t i = position; i < m_altFrequencies.count; i++)
+	{
+		m_altFrequencies.frequencies[i] = m_altFrequencies.frequencies[i + 1];
+		setAltFrequencyRegionalFlag(i, getAltFrequencyRegionalFlag(i + 1));
+	}
+	m_altFrequencies.frequencies[m_altFrequencies.count] = 0;
+	setAltFrequencyRegionalFlag(m_altFrequencies.count, false);
 }
 
 void RdsDecoder::prepareRadioText(void)
@@ -76,6 +265,7 @@ void RdsDecoder::prepareRadioText(void)
 	{
 		m_group2.textAbFlag = static_cast<bool>(*m_rdsDataBlocks.blockB & 0x0010);//set new flag value
 		memset(m_group2.radioText, 0, 65);//zero array with radiotext
+		m_radioTextPlus.count = 0;//tags describe previous text
 	}
 }
 
@@ -101,6 +291,156 @@ void RdsDecoder::setRadioText2B(void)
 	m_group2.radioText[startPosition + 1] = static_cast<char>(*m_rdsDataBlocks.blockD & 0x00FF);
 }
 
+RdsDecoder::groupType RdsDecoder::getOpenDataApplicationGroup(const uint16_t& applicationId) const
+{
+	if (!applicationId) return groupType::none;
+	for (uint8_t i = 0; i < static_cast<uint8_t>(groupType::none); i++)
+		if (m_openDataApplications.applicationIds[i] == applicationId) return static_cast<groupType>(i);
+	return groupType::none;
+}
+
+bool RdsDecoder::registerOpenDataApplication(const uint16_t& applicationId, odaHandler handler, void* context)
+{
+	uint8_t index = RDS_ODA_HANDLER_COUNT;
+
+	if (!applicationId || handler == nullptr) return false;
+	for (uint8_t i = 0; i < RDS_ODA_HANDLER_COUNT; i++)
+	{
+		if (m_openDataApplications.handlers[i].applicationId == applicationId) { index = i; break; }
+		if (!m_openDataApplications.handlers[i].applicationId && index == RDS_ODA_HANDLER_COUNT) index = i;//first free slot
+	}
+	if (index == RDS_ODA_HANDLER_COUNT) return false;
+
+	m_openDataApplications.handlers[index].applicationId = applicationId;
+	m_openDataApplications.handlers[index].handler = handler;
+	m_openDataApplications.handlers[index].context = context;
+	setOpenDataApplicationHandlerIndex(applicationId, index + 1);//application could be announced before handler was registered
+	return true;
+}
+
+void RdsDecoder::unregisterOpenDataApplication(const uint16_t& applicationId)
+{
+	for (uint8_t i = 0; i < RDS_ODA_HANDLER_COUNT; i++)
+	{
+		if (!applicationId || m_openDataApplications.handlers[i].applicationId != applicationId) continue;
+		memset(&m_openDataApplications.handlers[i], 0, sizeof(m_openDataApplications.handlers[i]));
+		setOpenDataApplicationHandlerIndex(applicationId, 0);
+	}
+}
+
+void RdsDecoder::clearOpenDataApplications(void)
+{
+	memset(m_openDataApplications.applicationIds, 0, sizeof(m_openDataApplications.applicationIds));
+	memset(m_openDataApplications.handlerIndices, 0, sizeof(m_openDataApplications.handlerIndices));
+}
+
+void RdsDecoder::setOpenDataApplication(void)
+{
+	const uint8_t type = static_cast<uint8_t>(*m_rdsDataBlocks.blockB & 0x001F);//the same coding as in groupType
+	const uint16_t applicationId = *m_rdsDataBlocks.blockD;
+	uint8_t handlerIndex = 0;
+
+	if (!applicationId) return;
+	for (uint8_t i = 0; i < RDS_ODA_HANDLER_COUNT; i++)
+		if (m_openDataApplications.handlers[i].applicationId == applicationId) handlerIndex = i + 1;
+
+	if (type && type != 0x1F && type != static_cast<uint8_t>(groupType::g3A))
+	{//0 means that application doesn't use other groups, 31 means temporary data fault
+		m_openDataApplications.applicationIds[type] = applicationId;
+		m_openDataApplications.handlerIndices[type] = handlerIndex;
+	}
+	if (handlerIndex) dispatchOpenDataApplication(handlerIndex - 1, groupType::g3A);//block C carries application data
+}
+
+void RdsDecoder::dispatchOpenDataApplication(const uint8_t& handlerIndex, const groupType& type) const
+{
+	const uint16_t* const blocks[] = { m_rdsDataBlocks.blockA, m_rdsDataBlocks.blockB, m_rdsDataBlocks.blockC, m_rdsDataBlocks.blockD };
+
+	m_openDataApplications.handlers[handlerIndex].handler(m_openDataApplications.handlers[handlerIndex].context, m_openDataApplications.handlers[handlerIndex].applicationId, type, blocks);
+}
+
+void RdsDecoder::setOpenDataApplicationHandlerIndex(const uint16_t& applicationId, const uint8_t& handlerIndex)
+{
+	for (uint8_t i = 0; i < static_cast<uint8_t>(groupType::none); i++)
+		if (m_openDataApplications.applicationIds[i] == applicationId) m_openDataApplications.handlerIndices[i] = handlerIndex;
+}
+
+RdsDecoder::textView RdsDecoder::getRadioTextPlusTagText(const uint8_t& index) const
+{
+	if (index >= m_radioTextPlus.count) return { nullptr, 0 };
+	const char* const text = &m_group2.radioText[m_radioTextPlus.tags[index].start];
+
+	for (uint8_t i = 0; i < m_radioTextPlus.tags[index].length; i++)
+		if (!text[i]) return { nullptr, 0 };//part of text is still missing
+	return { text, m_radioTextPlus.tags[index].length };
+}
+
+RdsDecoder::textView RdsDecoder::getRadioTextPlusTag(const radioTextPlusContentType& contentType) const
+{
+	for (uint8_t i = 0; i < m_radioTextPlus.count; i++)
+		if (m_radioTextPlus.tags[i].contentType == static_cast<uint8_t>(contentType)) return getRadioTextPlusTagText(i);
+	return { nullptr, 0 };
+}
+
+void RdsDecoder::decodeRadioTextPlus(void* context, const uint16_t& /*applicationId*/, const groupType& type, const uint16_t* const blocks[4])
+{
+	RdsDecoder& decoder = *static_cast<RdsDecoder*>(context);
+	const bool itemToggle = static_cast<bool>(*blocks[1] & 0x0010);
+	const bool itemRunning = static_cast<bool>(*blocks[1] & 0x0008);
+
+	if (type == groupType::g3A) return;//template number and CB flag from group 3A are not needed
+	if (itemToggle != decoder.m_radioTextPlus.itemToggle || itemRunning != decoder.m_radioTextPlus.itemRunning)
+	{//other item is broadcasted, or item has ended
+		decoder.m_radioTextPlus.count = 0;
+		decoder.m_radioTextPlus.itemToggle = itemToggle;
+		decoder.m_radioTextPlus.itemRunning = itemRunning;
+	}
+
+	decoder.addRadioTextPlusTag(static_cast<uint8_t>(((*blocks[1] & 0x0007) << 3) | ((*blocks[2] & 0xE000) >> 13)),
+		static_cast<uint8_t>((*blocks[2] & 0x1F80) >> 7), static_cast<uint8_t>(((*blocks[2] & 0x007E) >> 1) + 1));//length marker is number of additional chars
+	decoder.addRadioTextPlusTag(static_cast<uint8_t>(((*blocks[2] & 0x0001) << 5) | ((*blocks[3] & 0xF800) >> 11)),
+		static_cast<uint8_t>((*blocks[3] & 0x07E0) >> 5), static_cast<uint8_t>((*blocks[3] & 0x001F) + 1));
+}
+
+void RdsDecoder::addRadioTextPlusTag(const uint8_t& contentType, const uint8_t& start, const uint8_t& length)
+{
+	uint8_t index = 0;
+
+	if (!contentType || (start + length) > 64) return;//dummy tag or tag outside of RadioText
+	while (index < m_radioTextPlus.count && m_radioTextPlus.tags[index].contentType != contentType) index++;
+	if (index >= RDS_RTPLUS_TAG_COUNT)
+	{//no space left, remove the oldest tag
+		memmove(&m_radioTextPlus.tags[0], &m_radioTextPlus.tags[1], sizeof(m_radioTextPlus.tags[0]) * (RDS_RTPLUS_TAG_COUNT - 1));
+		index = RDS_RTPLUS_TAG_COUNT - 1;
+	}
+	else if (index == m_radioTextPlus.count) m_radioTextPlus.count++;
+
+	m_radioTextPlus.tags[index].contentType = contentType;
+	m_radioTextPlus.tags[index].start = start;
+	m_radioTextPlus.tags[index].length = length;
+}
+
+#if RDS_ENHANCED_RADIOTEXT
+void RdsDecoder::decodeEnhancedRadioText(void* context, const uint16_t& /*applicationId*/, const groupType& type, const uint16_t* const blocks[4])
+{
+	RdsDecoder& decoder = *static_cast<RdsDecoder*>(context);
+
+	if (type == groupType::g3A)
+	{
+		if (static_cast<bool>(*blocks[2] & 0x0001) != decoder.m_enhancedRadioText.utf8)
+		{//encoding has changed, so received text is not valid anymore
+			memset(&decoder.m_enhancedRadioText, 0, sizeof(decoder.m_enhancedRadioText));
+			decoder.m_enhancedRadioText.utf8 = static_cast<bool>(*blocks[2] & 0x0001);
+		}
+		return;
+	}
+	if (!decoder.m_enhancedRadioText.utf8) return;//UCS-2 encoding is not supported
+
+	setSegmentedText(decoder.m_enhancedRadioText.text, sizeof(decoder.m_enhancedRadioText.text), decoder.m_enhancedRadioText.receivedSegments,
+		decoder.m_enhancedRadioText.endPosition, static_cast<uint8_t>(*blocks[1] & 0x001F), *blocks[2], *blocks[3]);
+}
+#endif
+
 void RdsDecoder::prepareTimeAndDate(void)
 {
 	m_group4A.modifiedJulianDay = static_cast<unsigned int>(((*m_rdsDataBlocks.blockB & 0x0003) << 14) | (*m_rdsDataBlocks.blockC & 0xFFFE));
@@ -141,6 +481,138 @@ void RdsDecoder::setDate(void)
 	if (m_date.weekNumber > 53) m_date.weekNumber = 53; else if (m_date.weekNumber == 0) m_date.weekNumber = 1;
 }
 
+void RdsDecoder::setTrafficMessage(void)
+{
+	static const uint16_t durations[] = { 15, 15, 30, 60, 120, 180, 240, 1440 };//in minutes, end of day is unknown, so one day is used for the last one
+	const uint8_t index = static_cast<uint8_t>(*m_rdsDataBlocks.blockB & 0x0007);//DP code for single-group messages, CI for multi-group ones
+	trafficMessage message = { 0 };
+
+	removeExpiredTrafficMessages();
+	if (*m_rdsDataBlocks.blockB & 0x0010) return;//tuning information and system messages are not supported
+
+	if ((*m_rdsDataBlocks.blockB & 0x0008) || (*m_rdsDataBlocks.blockC & 0x8000))
+	{//single-group message or first group of multi-group message, both have the same layout
+		message.diversion = (*m_rdsDataBlocks.blockB & 0x0008) && (*m_rdsDataBlocks.blockC & 0x8000);
+		message.negativeDirection = static_cast<bool>(*m_rdsDataBlocks.blockC & 0x4000);
+		message.extent = static_cast<unsigned short>((*m_rdsDataBlocks.blockC & 0x3800) >> 11);
+		message.event = static_cast<unsigned short>(*m_rdsDataBlocks.blockC & 0x07FF);
+		message.location = *m_rdsDataBlocks.blockD;
+		if (*m_rdsDataBlocks.blockB & 0x0008)
+		{
+			message.durationPersistence = index;
+			message.lifeTime = durations[index] * 60000UL;
+			storeTrafficMessage(message);
+			return;
+		}
+		m_trafficMessageAssembly.message = message;
+		m_trafficMessageAssembly.continuityIndex = index;
+		m_trafficMessageAssembly.groupSequence = 0xFF;
+		m_trafficMessageAssembly.secondGroupReceived = false;
+		m_trafficMessageAssembly.active = true;
+		return;
+	}
+
+	if (!m_trafficMessageAssembly.active || m_trafficMessageAssembly.continuityIndex != index) return;//first group is missing
+	const uint8_t sequence = static_cast<uint8_t>((*m_rdsDataBlocks.blockC & 0x3000) >> 12);
+	if (sequence == m_trafficMessageAssembly.groupSequence) return;//repeated group
+	if ((*m_rdsDataBlocks.blockC & 0x4000) ? m_trafficMessageAssembly.secondGroupReceived :
+		(!m_trafficMessageAssembly.secondGroupReceived || sequence != m_trafficMessageAssembly.groupSequence - 1))
+	{//group is out of sequence, message can't be assembled
+		m_trafficMessageAssembly.active = false;
+		return;
+	}
+
+	m_trafficMessageAssembly.secondGroupReceived = true;
+	m_trafficMessageAssembly.groupSequence = sequence;
+	addTrafficMessageFreeFormat();
+	if (sequence) return;//more groups will follow
+
+	m_trafficMessageAssembly.active = false;
+	m_trafficMessageAssembly.message.durationPersistence = getTrafficMessageFreeFormatDuration(m_trafficMessageAssembly.message);
+	m_trafficMessageAssembly.message.lifeTime = durations[m_trafficMessageAssembly.message.durationPersistence] * 60000UL;
+	storeTrafficMessage(m_trafficMessageAssembly.message);
+}
+
+void RdsDecoder::addTrafficMessageFreeFormat(void)
+{
+	trafficMessage& message = m_trafficMessageAssembly.message;
+	const uint32_t data = (static_cast<uint32_t>(*m_rdsDataBlocks.blockC & 0x0FFF) << 16) | *m_rdsDataBlocks.blockD;
+
+	for (int8_t i = 27; i >= 0 && message.freeFormatLength < RDS_TMC_FREE_FORMAT_SIZE * 8; i--, message.freeFormatLength++)
+		if (data & (1UL << i)) message.freeFormat[message.freeFormatLength / 8] |= static_cast<uint8_t>(0x80 >> (message.freeFormatLength % 8));
+}
+
+uint8_t RdsDecoder::getTrafficMessageFreeFormatDuration(const trafficMessage& message)
+{
+	static const uint8_t labelLengths[] = { 3, 3, 5, 5, 5, 8, 8, 8, 8, 11, 16, 16, 16, 16, 0, 0 };
+	uint8_t position = 0;
+
+	while ((position + 4) <= message.freeFormatLength)
+	{
+		const uint8_t label = static_cast<uint8_t>(getTrafficMessageFreeFormatBits(message, position, 4));
+		position += 4;
+		if ((position + labelLengths[label]) > message.freeFormatLength) break;//rest of data is padding
+		if (!label) return static_cast<uint8_t>(getTrafficMessageFreeFormatBits(message, position, 3));
+		if (label == 15) break;//reserved label, rest of data can't be interpreted
+		position += labelLengths[label];
+	}
+	return 0;
+}
+
+uint16_t RdsDecoder::getTrafficMessageFreeFormatBits(const trafficMessage& message, const uint8_t& position, const uint8_t& length)
+{
+	uint16_t value = 0;
+
+	for (uint8_t i = position; i < (position + length); i++)
+		value = static_cast<uint16_t>((value << 1) | ((message.freeFormat[i / 8] >> (7 - (i % 8))) & 0x01));
+	return value;
+}
+
+uint8_t RdsDecoder::findTrafficMessage(const uint16_t& event, const uint16_t& location) const
+{
+	for (uint8_t i = 0; i < m_trafficMessages.count; i++)
+		if (m_trafficMessages.messages[i].event == event && m_trafficMessages.messages[i].location == location) return i;
+	return 0xFF;
+}
+
+void RdsDecoder::removeExpiredTrafficMessages(void)
+{
+	uint8_t count = 0;
+
+	for (uint8_t i = 0; i < m_trafficMessages.count; i++)
+	{
+		if ((millis() - m_trafficMessages.messages[i].receiveTime) >= m_trafficMessages.messages[i].lifeTime) continue;
+		if (count != i) m_trafficMessages.messages[count] = m_trafficMessages.messages[i];
+		count++;
+	}
+	m_trafficMessages.count = count;
+}
+
+void RdsDecoder::clearTrafficMessages(void)
+{
+	m_trafficMessages.count = 0;
+	m_trafficMessageAssembly.active = false;
+}
+
+void RdsDecoder::storeTrafficMessage(trafficMessage& message)
+{
+	uint8_t index = findTrafficMessage(message.event, message.location);
+
+	message.receiveTime = millis();
+	if (index == 0xFF)
+	{
+		if (m_trafficMessages.count < RDS_TMC_STORE_SIZE) index = m_trafficMessages.count++;
+		else
+		{//store is full, replace message which expires first, expired ones were already removed
+			index = 0;
+			for (uint8_t i = 1; i < RDS_TMC_STORE_SIZE; i++)
+				if ((m_trafficMessages.messages[i].lifeTime - (message.receiveTime - m_trafficMessages.messages[i].receiveTime)) <
+					(m_trafficMessages.messages[index].lifeTime - (message.receiveTime - m_trafficMessages.messages[index].receiveTime))) index = i;
+		}
+	}
+	m_trafficMessages.messages[index] = message;
+}
+
 void RdsDecoder::setProgrammeTypeName(void)
 {
 	if (*m_rdsDataBlocks.blockB & 0x000E) return;//check if bits have expected value, if not then don't do nothing
@@ -164,3 +636,146 @@ void RdsDecoder::setProgrammeTypeName(void)
 		m_group10A.programmeTypeName[3] = static_cast<char>(*m_rdsDataBlocks.blockD & 0x00FF);
 	}
 }
+
+uint8_t RdsDecoder::findOtherNetwork(const uint16_t& programmeIdentification) const
+{
+	for (uint8_t i = 0; i < m_otherNetworks.count; i++)
+		if (m_otherNetworks.programmeIdentifications[i] == programmeIdentification) return i;
+	return 0xFF;
+}
+
+void RdsDecoder::clearOtherNetworks(void)
+{
+	memset(&m_otherNetworks, 0, sizeof(m_otherNetworks));
+	m_otherNetworks.trafficAnnouncementIndex = 0xFF;
+}
+
+void RdsDecoder::setOtherNetworkInformation(void)
+{
+	if (!*m_rdsDataBlocks.blockD) return;//PI of other network is always in block D
+	const uint8_t index = getOtherNetworkEntry(*m_rdsDataBlocks.blockD);
+	otherNetwork& entry = m_otherNetworks.entries[index];
+	const uint8_t codes[] = { static_cast<uint8_t>((*m_rdsDataBlocks.blockC & 0xFF00) >> 8), static_cast<uint8_t>(*m_rdsDataBlocks.blockC & 0x00FF) };
+	const uint8_t variant = static_cast<uint8_t>(*m_rdsDataBlocks.blockB & 0x000F);
+
+	entry.trafficProgramme = static_cast<bool>(*m_rdsDataBlocks.blockB & 0x0010);
+	entry.lastUpdate = ++m_otherNetworks.updateCounter;
+	if (getVersion())
+	{//group 14B is sent when TA on other network changes, block C contains PI of tuned network
+		setOtherNetworkTrafficAnnouncement(index, static_cast<bool>(*m_rdsDataBlocks.blockB & 0x0008));
+		return;
+	}
+
+	if (variant <= 3)
+	{//PS name, two chars for each variant
+		entry.programmeServiceName[variant * 2] = static_cast<char>(codes[0]);
+		entry.programmeServiceName[(variant * 2) + 1] = static_cast<char>(codes[1]);
+	}
+	else if (variant == 4)
+	{//AF list sent using method A, list header contains only first frequency
+		if (codes[0] == 250) return;//second code is LF/MF frequency
+		addOtherNetworkFrequency(entry, codes[0], false);
+		addOtherNetworkFrequency(entry, codes[1], false);
+	}
+	else if (variant <= 8)
+	{//frequency of other network mapped to frequency of tuned network, preferred only if it is mapped to received one
+		const bool mapped = m_tunedFrequencyCode && codes[0] == m_tunedFrequencyCode;
+
+		addOtherNetworkFrequency(entry, codes[1], mapped);
+		if (mapped) entry.mappedTunedFrequency = codes[0];
+	}
+	else if (variant == 13)
+	{
+		entry.progType = static_cast<programmeType>((*m_rdsDataBlocks.blockC & 0xF800) >> 11);
+		setOtherNetworkTrafficAnnouncement(index, static_cast<bool>(*m_rdsDataBlocks.blockC & 0x0001));
+	}
+	else if (variant == 14) entry.programmeItemNumber = *m_rdsDataBlocks.blockC;
+	//variant 9 is mapped AM frequency, 12 is linkage information and the rest is unallocated or reserved
+}
+
+uint8_t RdsDecoder::getOtherNetworkEntry(const uint16_t& programmeIdentification)
+{
+	uint8_t index = findOtherNetwork(programmeIdentification);
+
+	if (index != 0xFF) return index;
+	if (m_otherNetworks.count < RDS_EON_TABLE_SIZE) index = m_otherNetworks.count++;
+	else
+	{//table is full, replace entry which wasn't updated for the longest time
+		index = 0;
+		for (uint8_t i = 1; i < RDS_EON_TABLE_SIZE; i++)
+			if (static_cast<uint16_t>(m_otherNetworks.updateCounter - m_otherNetworks.entries[i].lastUpdate) >
+				static_cast<uint16_t>(m_otherNetworks.updateCounter - m_otherNetworks.entries[index].lastUpdate)) index = i;
+	}
+	m_otherNetworks.programmeIdentifications[index] = programmeIdentification;
+	memset(&m_otherNetworks.entries[index], 0, sizeof(otherNetwork));
+	return index;
+}
+
+void RdsDecoder::addOtherNetworkFrequency(otherNetwork& entry, const uint8_t& code, const bool& first)
+{
+	uint8_t position = 0;
+
+	if (!convertAlternativeFrequencyCode(code)) return;//not a VHF frequency
+	while (position < entry.frequencyCount && entry.frequencies[position] != code) position++;
+	if (position < entry.frequencyCount && (!first || !position)) return;//already on the list
+	if (position >= entry.frequencyCount)
+	{
+		if (entry.frequencyCount < RDS_EON_AF_LIST_SIZE) entry.frequencyCount++;
+		else if (!first) return;//no space left
+		position = entry.frequencyCount - 1;
+	}
+	if (!first)
+	{
+		entry.frequencies[position] = code;
+		return;
+	}
+
+	for (uint8_t i = position; i > 0; i--) entry.frequencies[i] = entry.frequencies[i - 1];//mapped frequency goes first, last one is dropped if list is full
+	entry.frequencies[0] = code;
+}
+
+void RdsDecoder::setOtherNetworkTrafficAnnouncement(const uint8_t& index, const bool& trafficAnnouncement)
+{
+	otherNetwork& entry = m_otherNetworks.entries[index];
+
+	if (trafficAnnouncement && !entry.trafficAnnouncement && entry.trafficProgramme) m_otherNetworks.trafficAnnouncementIndex = index;
+	entry.trafficAnnouncement = trafficAnnouncement;
+}
+
+#if RDS_LONG_PS || RDS_ENHANCED_RADIOTEXT
+void RdsDecoder::setSegmentedText(char* text, const uint8_t& size, uint32_t& receivedSegments, uint8_t& endPosition, const uint8_t& segment, const uint16_t& blockC, const uint16_t& blockD)
+{
+	const char bytes[] = { static_cast<char>((blockC & 0xFF00) >> 8), static_cast<char>(blockC & 0x00FF), static_cast<char>((blockD & 0xFF00) >> 8), static_cast<char>(blockD & 0x00FF) };
+	const uint8_t position = static_cast<uint8_t>(segment * 4);
+
+	if (position >= size) return;
+	if ((receivedSegments & (1UL << segment)) && memcmp(&text[position], bytes, 4))
+	{//station sends new text
+		memset(text, 0, size);
+		receivedSegments = 0;
+		endPosition = 0;
+	}
+
+	memcpy(&text[position], bytes, 4);
+	receivedSegments |= 1UL << segment;
+	for (uint8_t i = 0; i < 4; i++)
+	{
+		if (bytes[i] != 0x0D) continue;
+		if (!endPosition || (position + i) < (endPosition - 1)) endPosition = position + i + 1;//end mark
+		break;
+	}
+}
+
+RdsDecoder::textView RdsDecoder::getSegmentedText(const char* text, const uint8_t& size, const uint32_t& receivedSegments, const uint8_t& endPosition)
+{
+	const uint8_t length = endPosition ? (endPosition - 1) : size;
+	const uint8_t segments = static_cast<uint8_t>(endPosition ? (((endPosition - 1) / 4) + 1) : (size / 4));
+	const uint32_t requiredSegments = (segments >= 32) ? 0xFFFFFFFF : ((1UL << segments) - 1);
+	uint8_t textLength = length;
+
+	if ((receivedSegments & requiredSegments) != requiredSegments) return { nullptr, 0 };
+	while (textLength && !text[textLength - 1]) textLength--;//remove padding
+	if (!textLength) return { nullptr, 0 };
+	return { text, textLength };
+}
+#endif
@@ -15,6 +15,48 @@
 #include "WProgram.h"
 #endif
 
+#ifndef RDS_AF_LIST_SIZE
+#define RDS_AF_LIST_SIZE 25//max number of stored alternative frequencies, 25 is max length of one list
+#endif
+
+#ifndef RDS_PI_CONFIRMATIONS
+#define RDS_PI_CONFIRMATIONS 2//number of identical PI codes in a row which confirm identity of received station
+#endif
+
+#ifndef RDS_EON_TABLE_SIZE
+#define RDS_EON_TABLE_SIZE 8//max number of stored other networks from group 14A and 14B
+#endif
+
+#ifndef RDS_EON_AF_LIST_SIZE
+#define RDS_EON_AF_LIST_SIZE 4//max number of stored alternative frequencies of one other network
+#endif
+
+#ifndef RDS_TMC_STORE_SIZE
+#define RDS_TMC_STORE_SIZE 8//max number of stored traffic messages from group 8A
+#endif
+
+#define RDS_TMC_FREE_FORMAT_SIZE 14//4 subsequent groups of multi-group message with 28 bits each
+
+#ifndef RDS_ODA_HANDLER_COUNT
+#define RDS_ODA_HANDLER_COUNT 4//max number of registered Open Data Application handlers, including built-in RadioText Plus and eRT handlers
+#endif
+
+#ifndef RDS_LONG_PS
+#define RDS_LONG_PS 1//set to 0 to remove Long PS decoding from group 15A and save RAM
+#endif
+
+#ifndef RDS_ENHANCED_RADIOTEXT
+#define RDS_ENHANCED_RADIOTEXT 1//set to 0 to remove eRT decoding and save RAM
+#endif
+
+#define RDS_ERT_AID 0x6552//AID of Enhanced RadioText application
+
+#ifndef RDS_RTPLUS_TAG_COUNT
+#define RDS_RTPLUS_TAG_COUNT 4//max number of stored RadioText Plus tags
+#endif
+
+#define RDS_RTPLUS_AID 0x4BD7//AID of RadioText Plus application
+
 class RDA5807;
 class RdsDecoder final
 {
@@ -61,6 +103,67 @@ public:
 		religion, phoneIn, travel, leisure, jazz, country, national, oldies, folk, document,
 		test, alarm
 	};
+
+	/// <summary>
+	/// Possible programme type values in RBDS, used in north America.
+	/// </summary>
+	enum class rbdsProgrammeType : uint8_t
+	{
+		none, news, information, sports, talk, rock, classicRock, adultHits, softRock, top40,
+		country, oldies, soft, nostalgia, jazz, classical, rhythmAndBlues, softRhythmAndBlues, language, religiousMusic,
+		religiousTalk, personality, publicRadio, college, spanishTalk, spanishMusic, hipHop, weather = 29, emergencyTest, emergency
+	};
+
+	/// <summary>
+	/// Possible (RT+) RadioText Plus content types.
+	/// </summary>
+	enum class radioTextPlusContentType : uint8_t
+	{
+		dummy, itemTitle, itemAlbum, itemTrackNumber, itemArtist, itemComposition, itemMovement, itemConductor, itemComposer, itemBand,
+		itemComment, itemGenre, infoNews, infoNewsLocal, infoStockMarket, infoSport, infoLottery, infoHoroscope, infoDailyDiversion, infoHealth,
+		infoEvent, infoScene, infoCinema, infoStupidityMachine, infoDateTime, infoWeather, infoTraffic, infoAlarm, infoAdvertisement, infoUrl,
+		infoOther, stationNameShort, stationNameLong, programmeNow, programmeNext, programmePart, programmeHost, programmeEditorialStaff, programmeFrequency, programmeHomepage,
+		programmeSubchannel, phoneHotline, phoneStudio, phoneOther, smsStudio, smsOther, emailHotline, emailStudio, emailOther, mmsOther,
+		chat, chatCentre, voteQuestion, voteCentre, place = 59, appointment, identifier, purchase, getData
+	};
+#pragma endregion
+#pragma region RDS structs
+	/// <summary>
+	/// Non-owning view of text stored in decoder. Text isn't terminated by 0 and is valid until next group is decoded.
+	/// </summary>
+	struct textView
+	{
+		const char* data;//pointer to first char, nullptr if view is empty
+		uint8_t length;//number of chars
+	};
+
+	/// <summary>
+	/// (TMC) Traffic Message Channel user message from group 8A.
+	/// </summary>
+	struct trafficMessage
+	{
+		uint16_t location;//location code, its meaning depends on location table used by service
+		unsigned short
+			event : 11,//event code from ISO 14819-2 event list
+			extent : 3,//number of locations affected by event, counted from primary location
+			negativeDirection : 1,//true if queue grows in negative direction of road
+			diversion : 1;//true if diversion is advised
+		uint8_t durationPersistence;//DP code from 0 to 7
+		uint8_t freeFormatLength;//number of bits of free format data, 0 for single-group messages
+		uint8_t freeFormat[RDS_TMC_FREE_FORMAT_SIZE];//free format data of multi-group message, first bit is the MSB of first byte
+		unsigned long receiveTime;//value of millis() when message was received last time
+		unsigned long lifeTime;//time in ms after which message expires, counted from receive time
+	};
+
+	/// <summary>
+	/// (ODA) Open Data Application handler. It is called with group 3A which announces application,
+	/// and with every group of type which station assigned to this application.
+	/// </summary>
+	/// <param name="context">pointer passed during registration</param>
+	/// <param name="applicationId">(AID) Application Identification code</param>
+	/// <param name="type">type of received group</param>
+	/// <param name="blocks">blocks A, B, C and D of received group</param>
+	typedef void(*odaHandler)(void* context, const uint16_t& applicationId, const groupType& type, const uint16_t* const blocks[4]);
 #pragma endregion
 private:
 #pragma region RDS groups
@@ -86,6 +189,21 @@ private:
 		uint8_t programmeReferenceNumber;
 	} m_programmeIdentification = { 0 };
 
+	/// <summary>
+	/// Tracking of full PI code, used to confirm identity of received station.
+	/// </summary>
+	struct
+	{
+		uint16_t code;//last received PI code
+		uint16_t confirmedCode;//PI code received RDS_PI_CONFIRMATIONS times in a row, 0 if not confirmed yet
+		uint16_t previousConfirmedCode;//the last confirmed PI code before tracking was reset
+		uint8_t matches;//number of identical PI codes received in a row
+		bool confirmedEvent : 1;//true if PI code was confirmed in last decoded group
+		bool changedEvent : 1;//true if PI code was confirmed in last decoded group and is different than previous one
+		unsigned long resetTime;//value of millis() when tracking was reset
+		unsigned long confirmTime;//time in ms from reset to confirmation
+	} m_piTracking = { 0 };
+
 	/// <summary>
 	/// Data from block B.
 	/// </summary>
@@ -95,19 +213,36 @@ private:
 		programmeType progType;
 	} m_blockBData = { 0 };
 
+	bool m_rbdsMode = false;//true if received data has to be interpreted according to RBDS standard
+
 	/// <summary>
 	/// RDS data group 0A and 0B.
 	/// </summary>
 	struct
 	{
-		//uint8_t altFrequency0;//TODO, if needed
-		//uint8_t altFrequency1;//TODO, if needed
 		bool trafficAnnouncement : 1;
 		bool musicSpeech : 1;
 		unsigned short decoderControlBits : 4;
+		unsigned short receivedSegments : 4;//bit is set for every received segment of PS name
 		char programmeServiceName[9];//8 chars for station name and one 0 as end mark
 	} m_group0 = { 0 };
 
+	/// <summary>
+	/// (AF) Alternative Frequencies list from group 0A.
+	/// </summary>
+	struct
+	{
+		uint16_t programmeIdentification;//PI of station which broadcasts this list
+		uint8_t headerFrequency;//AF code sent with number of frequencies, in method B it is the tuned frequency
+		uint8_t expectedCount;//number of frequencies announced in list header
+		uint8_t count;//number of stored frequencies
+		bool methodB : 1;
+		bool skipNextCode : 1;//set when next code is LF/MF frequency, which is not supported
+		uint8_t frequencies[RDS_AF_LIST_SIZE];//AF codes sorted in ascending order
+		uint8_t regionalVariants[(RDS_AF_LIST_SIZE + 7) / 8];//bit is set if frequency carries regional variant of programme, used only in method B
+	} m_altFrequencies = { 0 };
+	uint8_t m_tunedFrequencyCode = 0;//AF code of received frequency, used to pick method B list sent for it, 0 if frequency isn't known
+
 	/// <summary>
 	/// RDS data group 1A and 1B.
 	/// </summary>
@@ -138,6 +273,100 @@ private:
 		char radioText[65];//64 chars for text and one 0 as end mark
 	} m_group2 = { 0 };
 
+	/// <summary>
+	/// (RT+) RadioText Plus tags, which mark parts of RadioText.
+	/// </summary>
+	struct
+	{
+		struct
+		{
+			uint8_t contentType;
+			uint8_t start;//position of first char in RadioText
+			uint8_t length;
+		} tags[RDS_RTPLUS_TAG_COUNT];
+		uint8_t count;
+		bool itemToggle : 1;
+		bool itemRunning : 1;
+	} m_radioTextPlus = { 0 };
+
+	/// <summary>
+	/// Information about one other network from group 14A and 14B.
+	/// </summary>
+	struct otherNetwork
+	{
+		char programmeServiceName[9];//8 chars for station name and one 0 as end mark
+		uint8_t frequencies[RDS_EON_AF_LIST_SIZE];//AF codes, including frequencies mapped to tuned network
+		uint8_t frequencyCount;
+		uint8_t mappedTunedFrequency;//AF code of tuned network frequency to which first frequency is mapped, 0 if it isn't mapped
+		programmeType progType;
+		bool trafficProgramme : 1;
+		bool trafficAnnouncement : 1;
+		uint16_t programmeItemNumber;
+		uint16_t lastUpdate;//value of update counter when this entry was last changed, used to replace the oldest entry
+	};
+
+	/// <summary>
+	/// (EON) Enhanced Other Networks table from group 14A and 14B.
+	/// PI codes are kept apart from entries, so lookup scans only one small array.
+	/// </summary>
+	struct
+	{
+		uint16_t programmeIdentifications[RDS_EON_TABLE_SIZE];
+		otherNetwork entries[RDS_EON_TABLE_SIZE];
+		uint16_t updateCounter;
+		uint8_t count;
+		uint8_t trafficAnnouncementIndex;//index of network on which TA started in last decoded group, 0xFF if none
+	} m_otherNetworks = { { 0 }, { { { 0 } } }, 0, 0, 0xFF };
+
+	/// <summary>
+	/// (TMC) Traffic Message Channel message store from group 8A.
+	/// </summary>
+	struct
+	{
+		trafficMessage messages[RDS_TMC_STORE_SIZE];
+		uint8_t count;
+	} m_trafficMessages = { 0 };
+
+	/// <summary>
+	/// Multi-group traffic message which is being assembled.
+	/// </summary>
+	struct
+	{
+		trafficMessage message;
+		uint8_t continuityIndex;
+		uint8_t groupSequence;//sequence indicator of last received subsequent group, it counts down to 0
+		bool active : 1;
+		bool secondGroupReceived : 1;
+	} m_trafficMessageAssembly = { 0 };
+
+	/// <summary>
+	/// (ODA) Open Data Applications announced in group 3A and registered handlers.
+	/// </summary>
+	struct
+	{
+		uint16_t applicationIds[static_cast<uint8_t>(groupType::none)];//AID assigned to every group type, 0 if none
+		uint8_t handlerIndices[static_cast<uint8_t>(groupType::none)];//index of handler + 1 for every group type, 0 if group has no handler
+		struct
+		{
+			uint16_t applicationId;
+			odaHandler handler;
+			void* context;
+		} handlers[RDS_ODA_HANDLER_COUNT];
+	} m_openDataApplications = { 0 };
+
+#if RDS_ENHANCED_RADIOTEXT
+	/// <summary>
+	/// (eRT) Enhanced RadioText, sent as UTF-8 in 32 segments.
+	/// </summary>
+	struct
+	{
+		char text[128];
+		uint32_t receivedSegments;//bit is set for every received segment
+		uint8_t endPosition;//position of end mark + 1, 0 if end mark wasn't received
+		bool utf8 : 1;//true if station announced UTF-8 encoding in group 3A
+	} m_enhancedRadioText = { 0 };
+#endif
+
 	/// <summary>
 	/// RDS data group 4A.
 	/// </summary>
@@ -159,6 +388,18 @@ private:
 		bool nameAbFlag : 1;
 		char programmeTypeName[9];//8 chars for programme type name and one 0 as end mark
 	} m_group10A = { 0 };
+
+#if RDS_LONG_PS
+	/// <summary>
+	/// RDS data group 15A, Long PS sent as UTF-8 in 8 segments.
+	/// </summary>
+	struct
+	{
+		char text[32];
+		uint32_t receivedSegments;//bit is set for every received segment
+		uint8_t endPosition;//position of end mark + 1, 0 if end mark wasn't received
+	} m_group15A = { 0 };
+#endif
 #pragma endregion
 	/// <summary>
 	/// Date data.
@@ -183,7 +424,13 @@ private:
 	/// <param name="blockC">pointer to block C of RDS data</param>
 	/// <param name="blockD">pointer to block D of RDS data</param>
 	RdsDecoder(uint16_t* blockA, uint16_t* blockB, uint16_t* blockC, uint16_t* blockD) :
-		m_rdsDataBlocks{ blockA, blockB, blockC, blockD } {};
+		m_rdsDataBlocks{ blockA, blockB, blockC, blockD }
+	{
+		registerOpenDataApplication(RDS_RTPLUS_AID, decodeRadioTextPlus, this);
+#if RDS_ENHANCED_RADIOTEXT
+		registerOpenDataApplication(RDS_ERT_AID, decodeEnhancedRadioText, this);
+#endif
+	};
 
 	RdsDecoder(const RdsDecoder&) = delete;
 	RdsDecoder& operator=(const RdsDecoder&) = delete;
@@ -207,6 +454,38 @@ public:
 	/// </summary>
 	/// <returns>programme reference number value</returns>
 	uint8_t getProgrammeReferenceNumber(void) const { return m_programmeIdentification.programmeReferenceNumber; }
+
+	/// <summary>
+	/// Returns full (PI) Programme Identification code from last decoded group.
+	/// </summary>
+	/// <returns>PI code</returns>
+	uint16_t getProgrammeIdentification(void) const { return m_piTracking.code; }
+
+	/// <summary>
+	/// Returns (PI) Programme Identification code which was received RDS_PI_CONFIRMATIONS times in a row since last frequency change.
+	/// Scans and AF checks can stop waiting for RDS data as soon as it is known.
+	/// </summary>
+	/// <returns>PI code, 0 if identity of station isn't confirmed yet</returns>
+	uint16_t getConfirmedProgrammeIdentification(void) const { return m_piTracking.confirmedCode; }
+
+	/// <summary>
+	/// Returns information if (PI) Programme Identification code was confirmed in last decoded group.
+	/// </summary>
+	/// <returns>true if PI code was confirmed, false otherwise</returns>
+	bool getProgrammeIdentificationConfirmedEvent(void) const { return m_piTracking.confirmedEvent; }
+
+	/// <summary>
+	/// Returns information if (PI) Programme Identification code confirmed in last decoded group is different than
+	/// the one confirmed before last frequency change, or if it has changed without frequency change.
+	/// </summary>
+	/// <returns>true if other station is received, false otherwise</returns>
+	bool getProgrammeIdentificationChangedEvent(void) const { return m_piTracking.changedEvent; }
+
+	/// <summary>
+	/// Returns time from last frequency change to confirmation of (PI) Programme Identification code.
+	/// </summary>
+	/// <returns>time in ms, 0 if PI code isn't confirmed yet</returns>
+	unsigned long getProgrammeIdentificationConfirmTime(void) const { return m_piTracking.confirmTime; }
 #pragma endregion
 
 #pragma region block B
@@ -221,6 +500,24 @@ public:
 	/// </summary>
 	/// <returns>received Programme Type</returns>
 	const programmeType& getProgrammeType(void) const { return m_blockBData.progType; }
+
+	/// <summary>
+	/// Returns received (PTY) Programme Type according to RBDS standard. Use it when RBDS mode is enabled.
+	/// </summary>
+	/// <returns>received Programme Type</returns>
+	rbdsProgrammeType getRbdsProgrammeType(void) const { return static_cast<rbdsProgrammeType>(m_blockBData.progType); }
+
+	/// <summary>
+	/// Returns received (PTY) Programme Type code, which can be used with both RDS and RBDS.
+	/// </summary>
+	/// <returns>Programme Type code from 0 to 31</returns>
+	uint8_t getProgrammeTypeCode(void) const { return static_cast<uint8_t>(m_blockBData.progType); }
+
+	/// <summary>
+	/// Returns information if RBDS mode is enabled, in which PTY codes have north american meaning and PI codes contain call signs.
+	/// </summary>
+	/// <returns>true if RBDS mode is enabled, false otherwise</returns>
+	bool getRbdsMode(void) const { return m_rbdsMode; }
 #pragma endregion
 
 #pragma region group 0
@@ -267,6 +564,72 @@ public:
 	/// </summary>
 	/// <returns>pointer to 8 char array</returns>
 	const char* getProgrammeServiceName(void) const { return m_group0.programmeServiceName; }
+
+	/// <summary>
+	/// Returns information if all 4 segments of programme name were received since segment 0.
+	/// </summary>
+	/// <returns>true if programme name is complete, false otherwise</returns>
+	bool getProgrammeServiceNameComplete(void) const { return m_group0.receivedSegments == 0x0F; }
+
+#pragma region alternative frequencies
+	/// <summary>
+	/// Returns number of stored (AF) Alternative Frequencies of received station.
+	/// </summary>
+	/// <returns>number of stored frequencies</returns>
+	uint8_t getAlternativeFrequencyCount(void) const { return m_altFrequencies.count; }
+
+	/// <summary>
+	/// Returns number of frequencies announced in AF list header. In method B lists this number includes tuned frequency.
+	/// </summary>
+	/// <returns>announced number of frequencies</returns>
+	uint8_t getAlternativeFrequencyExpectedCount(void) const { return m_altFrequencies.expectedCount; }
+
+	/// <summary>
+	/// Returns information if all frequencies announced in AF list header were received, or if there is no more space for them.
+	/// </summary>
+	/// <returns>true if list is complete, false otherwise</returns>
+	bool getAlternativeFrequencyListComplete(void) const;
+
+	/// <summary>
+	/// Returns information if AF list is sent using method B, in which every frequency is sent together with tuned frequency.
+	/// </summary>
+	/// <returns>true if method B, false if method A</returns>
+	bool getAlternativeFrequencyMethodB(void) const { return m_altFrequencies.methodB; }
+
+	/// <summary>
+	/// Returns (PI) Programme Identification code of station which broadcasts stored AF list.
+	/// </summary>
+	/// <returns>PI code, 0 if no list was received</returns>
+	uint16_t getAlternativeFrequencyListPi(void) const { return m_altFrequencies.programmeIdentification; }
+
+	/// <summary>
+	/// Returns AF code of frequency with given index. Frequencies are sorted in ascending order.
+	/// </summary>
+	/// <param name="index">index of frequency, from 0 to getAlternativeFrequencyCount() - 1</param>
+	/// <returns>AF code, 0 if index is out of range</returns>
+	uint8_t getAlternativeFrequencyCode(const uint8_t& index) const { return (index < m_altFrequencies.count) ? m_altFrequencies.frequencies[index] : 0; }
+
+	/// <summary>
+	/// Returns alternative frequency with given index, in the same format as used by RDA5807::updateReceivedFrequency(), ex: 919 is 91.9Mhz.
+	/// </summary>
+	/// <param name="index">index of frequency, from 0 to getAlternativeFrequencyCount() - 1</param>
+	/// <returns>frequency value, 0 if index is out of range</returns>
+	uint16_t getAlternativeFrequency(const uint8_t& index) const { return convertAlternativeFrequencyCode(getAlternativeFrequencyCode(index)); }
+
+	/// <summary>
+	/// Returns information if alternative frequency with given index carries regional variant of received programme. Used only in method B.
+	/// </summary>
+	/// <param name="index">index of frequency, from 0 to getAlternativeFrequencyCount() - 1</param>
+	/// <returns>true if it is regional variant, false otherwise</returns>
+	bool getAlternativeFrequencyRegionalVariant(const uint8_t& index) const { return (index < m_altFrequencies.count) && getAltFrequencyRegionalFlag(index); }
+
+	/// <summary>
+	/// Converts AF code to frequency, in the same format as used by RDA5807::updateReceivedFrequency(), ex: 919 is 91.9Mhz.
+	/// </summary>
+	/// <param name="code">AF code</param>
+	/// <returns>frequency value, 0 if code doesn't describe VHF frequency</returns>
+	static uint16_t convertAlternativeFrequencyCode(const uint8_t& code) { return (code && code < 205) ? static_cast<uint16_t>(875 + code) : 0; }
+#pragma endregion
 #pragma endregion
 #pragma region group 1A and 1B
 	/// <summary>
@@ -305,6 +668,65 @@ public:
 	/// </summary>
 	/// <returns>pointer to 64 char array</returns>
 	const char* getRadioText(void) const { return m_group2.radioText; }
+
+#pragma region radio text plus
+	/// <summary>
+	/// Returns number of stored (RT+) RadioText Plus tags. Tags are removed when RadioText changes or when broadcasted item changes.
+	/// </summary>
+	/// <returns>number of stored tags</returns>
+	uint8_t getRadioTextPlusTagCount(void) const { return m_radioTextPlus.count; }
+
+	/// <summary>
+	/// Returns content type of RadioText Plus tag with given index.
+	/// </summary>
+	/// <param name="index">index of tag, from 0 to getRadioTextPlusTagCount() - 1</param>
+	/// <returns>content type, dummy if index is out of range</returns>
+	radioTextPlusContentType getRadioTextPlusTagType(const uint8_t& index) const { return (index < m_radioTextPlus.count) ? static_cast<radioTextPlusContentType>(m_radioTextPlus.tags[index].contentType) : radioTextPlusContentType::dummy; }
+
+	/// <summary>
+	/// Returns view of RadioText part marked by RadioText Plus tag with given index. Text isn't copied, view points to RadioText buffer.
+	/// </summary>
+	/// <param name="index">index of tag, from 0 to getRadioTextPlusTagCount() - 1</param>
+	/// <returns>view of text, empty if index is out of range or not all chars of this part were received yet</returns>
+	textView getRadioTextPlusTagText(const uint8_t& index) const;
+
+	/// <summary>
+	/// Returns view of RadioText part marked by RadioText Plus tag with given content type, ex: itemTitle or itemArtist.
+	/// Text isn't copied, view points to RadioText buffer.
+	/// </summary>
+	/// <param name="contentType">content type of tag</param>
+	/// <returns>view of text, empty if there is no such tag or not all chars of this part were received yet</returns>
+	textView getRadioTextPlusTag(const radioTextPlusContentType& contentType) const;
+
+	/// <summary>
+	/// Returns information if item (ex: song) described by RadioText Plus item tags is being broadcasted.
+	/// </summary>
+	/// <returns>true if item is running, false otherwise</returns>
+	bool getRadioTextPlusItemRunning(void) const { return m_radioTextPlus.itemRunning; }
+#pragma endregion
+#if RDS_ENHANCED_RADIOTEXT
+	/// <summary>
+	/// Returns view of (eRT) Enhanced RadioText encoded in UTF-8, up to 128 bytes. Text isn't copied, view points to decoder buffer.
+	/// Only stations which announce UTF-8 encoding are supported.
+	/// </summary>
+	/// <returns>view of text, empty if not all segments were received yet</returns>
+	textView getEnhancedRadioText(void) const { return getSegmentedText(m_enhancedRadioText.text, sizeof(m_enhancedRadioText.text), m_enhancedRadioText.receivedSegments, m_enhancedRadioText.endPosition); }
+#endif
+#pragma endregion
+#pragma region group 3A
+	/// <summary>
+	/// Returns (AID) Application Identification code of (ODA) Open Data Application which is carried in given group type.
+	/// </summary>
+	/// <param name="type">group type</param>
+	/// <returns>AID code, 0 if group type isn't assigned to any application</returns>
+	uint16_t getOpenDataApplicationId(const groupType& type) const { return (type < groupType::none) ? m_openDataApplications.applicationIds[static_cast<uint8_t>(type)] : 0; }
+
+	/// <summary>
+	/// Returns group type which carries (ODA) Open Data Application with given AID.
+	/// </summary>
+	/// <param name="applicationId">(AID) Application Identification code</param>
+	/// <returns>group type, none if application wasn't announced</returns>
+	groupType getOpenDataApplicationGroup(const uint16_t& applicationId) const;
 #pragma endregion
 #pragma region group 4A
 	/// <summary>
@@ -362,6 +784,34 @@ public:
 	/// <returns>local time offset</returns>
 	uint8_t getLocalTimeOffset(void) const { return m_group4A.localTimeOffset; }
 #pragma endregion
+#pragma region group 8A
+	/// <summary>
+	/// Returns number of stored (TMC) Traffic Message Channel messages. Expired messages are removed when new group 8A is decoded
+	/// or when removeExpiredTrafficMessages() is used.
+	/// </summary>
+	/// <returns>number of stored messages</returns>
+	uint8_t getTrafficMessageCount(void) const { return m_trafficMessages.count; }
+
+	/// <summary>
+	/// Returns stored traffic message with given index.
+	/// </summary>
+	/// <param name="index">index of message, from 0 to getTrafficMessageCount() - 1</param>
+	/// <returns>pointer to message, nullptr if index is out of range</returns>
+	const trafficMessage* getTrafficMessage(const uint8_t& index) const { return (index < m_trafficMessages.count) ? &m_trafficMessages.messages[index] : nullptr; }
+
+	/// <summary>
+	/// Returns index of stored traffic message with given event and location code.
+	/// </summary>
+	/// <param name="event">event code</param>
+	/// <param name="location">location code</param>
+	/// <returns>index of message, 0xFF if it isn't stored</returns>
+	uint8_t findTrafficMessage(const uint16_t& event, const uint16_t& location) const;
+
+	/// <summary>
+	/// Removes messages which have expired according to their duration and persistence.
+	/// </summary>
+	void removeExpiredTrafficMessages(void);
+#pragma endregion
 #pragma region group 10A
 	/// <summary>
 	/// Returns pointer to 8 char array containing programme type name.
@@ -369,8 +819,118 @@ public:
 	/// <returns>pointer to 8 char array</returns>
 	const char* getProgrammeTypeName(void) const { return m_group10A.programmeTypeName; }
 #pragma endregion
+#if RDS_LONG_PS
+#pragma region group 15A
+	/// <summary>
+	/// Returns view of Long PS encoded in UTF-8, up to 32 bytes. Text isn't copied, view points to decoder buffer.
+	/// </summary>
+	/// <returns>view of text, empty if not all segments were received yet</returns>
+	textView getLongProgrammeServiceName(void) const { return getSegmentedText(m_group15A.text, sizeof(m_group15A.text), m_group15A.receivedSegments, m_group15A.endPosition); }
+#pragma endregion
+#endif
+#pragma region group 14A and 14B
+	/// <summary>
+	/// Returns number of other networks stored in (EON) Enhanced Other Networks table.
+	/// </summary>
+	/// <returns>number of stored networks</returns>
+	uint8_t getOtherNetworkCount(void) const { return m_otherNetworks.count; }
+
+	/// <summary>
+	/// Returns index of other network with given (PI) Programme Identification code.
+	/// </summary>
+	/// <param name="programmeIdentification">PI code of other network</param>
+	/// <returns>index of network, 0xFF if it isn't stored</returns>
+	uint8_t findOtherNetwork(const uint16_t& programmeIdentification) const;
+
+	/// <summary>
+	/// Returns (PI) Programme Identification code of other network with given index.
+	/// </summary>
+	/// <param name="index">index of network, from 0 to getOtherNetworkCount() - 1</param>
+	/// <returns>PI code, 0 if index is out of range</returns>
+	uint16_t getOtherNetworkPi(const uint8_t& index) const { return (index < m_otherNetworks.count) ? m_otherNetworks.programmeIdentifications[index] : 0; }
+
+	/// <summary>
+	/// Returns pointer to 8 char array containing programme name of other network with given index.
+	/// </summary>
+	/// <param name="index">index of network, from 0 to getOtherNetworkCount() - 1</param>
+	/// <returns>pointer to 8 char array, nullptr if index is out of range</returns>
+	const char* getOtherNetworkProgrammeServiceName(const uint8_t& index) const { return (index < m_otherNetworks.count) ? m_otherNetworks.entries[index].programmeServiceName : nullptr; }
+
+	/// <summary>
+	/// Returns (PTY) Programme Type of other network with given index.
+	/// </summary>
+	/// <param name="index">index of network, from 0 to getOtherNetworkCount() - 1</param>
+	/// <returns>Programme Type, none if index is out of range</returns>
+	programmeType getOtherNetworkProgrammeType(const uint8_t& index) const { return (index < m_otherNetworks.count) ? m_otherNetworks.entries[index].progType : programmeType::none; }
+
+	/// <summary>
+	/// Returns information if (TP) Traffic Programme information is carried by other network with given index.
+	/// </summary>
+	/// <param name="index">index of network, from 0 to getOtherNetworkCount() - 1</param>
+	/// <returns>true if Traffic Programme information is carried, false otherwise</returns>
+	bool getOtherNetworkTrafficProgramme(const uint8_t& index) const { return (index < m_otherNetworks.count) && m_otherNetworks.entries[index].trafficProgramme; }
+
+	/// <summary>
+	/// Returns information if (TA) Traffic Announcement is being broadcasted on other network with given index.
+	/// </summary>
+	/// <param name="index">index of network, from 0 to getOtherNetworkCount() - 1</param>
+	/// <returns>true if Traffic Announcement is being broadcasted, false otherwise</returns>
+	bool getOtherNetworkTrafficAnnouncement(const uint8_t& index) const { return (index < m_otherNetworks.count) && m_otherNetworks.entries[index].trafficAnnouncement; }
+
+	/// <summary>
+	/// Returns (PIN) Programme Item Number code of other network with given index, in the same format as sent in group 1A and 1B.
+	/// </summary>
+	/// <param name="index">index of network, from 0 to getOtherNetworkCount() - 1</param>
+	/// <returns>PIN code, 0 if index is out of range or code wasn't received</returns>
+	uint16_t getOtherNetworkProgrammeItemNumber(const uint8_t& index) const { return (index < m_otherNetworks.count) ? m_otherNetworks.entries[index].programmeItemNumber : 0; }
+
+	/// <summary>
+	/// Returns number of stored alternative frequencies of other network with given index.
+	/// </summary>
+	/// <param name="index">index of network, from 0 to getOtherNetworkCount() - 1</param>
+	/// <returns>number of stored frequencies</returns>
+	uint8_t getOtherNetworkFrequencyCount(const uint8_t& index) const { return (index < m_otherNetworks.count) ? m_otherNetworks.entries[index].frequencyCount : 0; }
+
+	/// <summary>
+	/// Returns alternative frequency of other network, in the same format as used by RDA5807::updateReceivedFrequency(), ex: 919 is 91.9Mhz.
+	/// Frequency mapped to received frequency of tuned network is stored first.
+	/// </summary>
+	/// <param name="index">index of network, from 0 to getOtherNetworkCount() - 1</param>
+	/// <param name="frequencyIndex">index of frequency, from 0 to getOtherNetworkFrequencyCount() - 1</param>
+	/// <returns>frequency value, 0 if any index is out of range</returns>
+	uint16_t getOtherNetworkFrequency(const uint8_t& index, const uint8_t& frequencyIndex) const
+	{
+		if (frequencyIndex >= getOtherNetworkFrequencyCount(index)) return 0;
+		return convertAlternativeFrequencyCode(m_otherNetworks.entries[index].frequencies[frequencyIndex]);
+	}
+
+	/// <summary>
+	/// Returns frequency of other network mapped to received frequency of tuned network, which is the best one to tune to.
+	/// </summary>
+	/// <param name="index">index of network, from 0 to getOtherNetworkCount() - 1</param>
+	/// <returns>frequency value, ex: 919 is 91.9Mhz, 0 if index is out of range or no frequency is mapped to received one</returns>
+	uint16_t getOtherNetworkMappedFrequency(const uint8_t& index) const
+	{
+		if (!getOtherNetworkFrequencyCount(index) || !m_tunedFrequencyCode || m_otherNetworks.entries[index].mappedTunedFrequency != m_tunedFrequencyCode) return 0;
+		return convertAlternativeFrequencyCode(m_otherNetworks.entries[index].frequencies[0]);
+	}
+
+	/// <summary>
+	/// Returns index of other network on which (TA) Traffic Announcement has started, if it was reported in last decoded group.
+	/// Only networks which carry Traffic Programme information are reported. Use it right after group 14A or 14B was decoded,
+	/// then tune to one of frequencies of this network to receive the announcement.
+	/// </summary>
+	/// <returns>index of network, 0xFF if no Traffic Announcement has started</returns>
+	uint8_t getOtherNetworkTrafficAnnouncementEvent(void) const { return m_otherNetworks.trafficAnnouncementIndex; }
+#pragma endregion
 
 private:
+	/// <summary>
+	/// Clears decoded data which belongs to received station: PS, PTYN, RadioText, AF list, other networks, traffic messages
+	/// and assignment of groups to Open Data Applications. Used by RDA5807 after tuning to other station.
+	/// </summary>
+	void clearStationData(void);
+
 	/// <summary>
 	/// Decodes received RDS data and sets result in appropriate structure.
 	/// </summary>
@@ -382,7 +942,7 @@ private:
 	/// Returns group type code. This code specifies what type of information were received.
 	/// </summary>
 	/// <returns>group type code</returns>
-	groupType getGroupTypeCode(void) const { return static_cast<groupType>(((*m_rdsDataBlocks.blockB & 0xF000) >> 12) | getVersion()); }
+	groupType getGroupTypeCode(void) const { return static_cast<groupType>(((*m_rdsDataBlocks.blockB & 0xF000) >> 11) | getVersion()); }
 
 	/// <summary>
 	/// Sets country code. Country codes are not unique. To make use of them, one needs to know where receiver is located.
@@ -398,6 +958,18 @@ private:
 	/// Sets programme reference number. This number is used to differentiate between programme families.
 	/// </summary>
 	void setProgrammeReferenceNumber(void) { m_programmeIdentification.programmeReferenceNumber = static_cast<uint8_t>(*m_rdsDataBlocks.blockA & 0x00FF); }
+
+	/// <summary>
+	/// Sets full (PI) Programme Identification code and confirms it when it was received enough times in a row.
+	/// In version B groups PI code is also in block C, so it is counted twice.
+	/// </summary>
+	void setProgrammeIdentification(void);
+
+	/// <summary>
+	/// Resets confirmation of (PI) Programme Identification code. Used by RDA5807 when frequency is changed.
+	/// </summary>
+	/// <param name="freq">new frequency, ex: 919 is 91.9Mhz, 0 if it isn't known</param>
+	void resetProgrammeIdentification(const uint16_t& freq);
 #pragma endregion
 #pragma region block B
 	/// <summary>
@@ -421,6 +993,42 @@ private:
 	/// Decodes information about (PS) Programme Service name and (DI) decoder identification control code.
 	/// </summary>
 	void setProgrammeServiceName(void);
+
+	/// <summary>
+	/// Decodes (AF) Alternative Frequencies codes from block C of group 0A and adds them to AF list of received station.
+	/// </summary>
+	void setAlternativeFrequencies(void);
+
+	/// <summary>
+	/// Adds frequency to sorted AF list. Frequencies already on the list and frequencies which don't fit in the list are skipped.
+	/// </summary>
+	/// <param name="code">AF code</param>
+	/// <param name="regionalVariant">true if frequency carries regional variant of programme</param>
+	void addAlternativeFrequency(const uint8_t& code, const bool& regionalVariant);
+
+	/// <summary>
+	/// Removes frequency from AF list.
+	/// </summary>
+	/// <param name="code">AF code</param>
+	void removeAlternativeFrequency(const uint8_t& code);
+
+	/// <summary>
+	/// Returns regional variant flag of frequency with given index.
+	/// </summary>
+	/// <param name="index">index of frequency</param>
+	/// <returns>flag value</returns>
+	bool getAltFrequencyRegionalFlag(const uint8_t& index) const { return m_altFrequencies.regionalVariants[index / 8] & (1 << (index % 8)); }
+
+	/// <summary>
+	/// Sets regional variant flag of frequency with given index.
+	/// </summary>
+	/// <param name="index">index of frequency</param>
+	/// <param name="flag">flag value</param>
+	void setAltFrequencyRegionalFlag(const uint8_t& index, const bool& flag)
+	{
+		if (flag) m_altFrequencies.regionalVariants[index / 8] |= static_cast<uint8_t>(1 << (index % 8));
+		else m_altFrequencies.regionalVariants[index / 8] &= static_cast<uint8_t>(~(1 << (index % 8)));
+	}
 #pragma endregion
 #pragma region group 1A and 1B
 	/// <summary>
@@ -453,6 +1061,74 @@ private:
 	/// Decodes RadioText from group 2B.
 	/// </summary>
 	void setRadioText2B(void);
+
+	/// <summary>
+	/// Built-in (ODA) Open Data Application handler which decodes (RT+) RadioText Plus tags.
+	/// </summary>
+	/// <param name="context">pointer to decoder</param>
+	/// <param name="applicationId">AID of RadioText Plus</param>
+	/// <param name="type">type of received group</param>
+	/// <param name="blocks">blocks A, B, C and D of received group</param>
+	static void decodeRadioTextPlus(void* context, const uint16_t& applicationId, const groupType& type, const uint16_t* const blocks[4]);
+
+	/// <summary>
+	/// Adds RadioText Plus tag. Tag with the same content type is replaced, the oldest one is removed if there is no space left.
+	/// </summary>
+	/// <param name="contentType">content type of tag</param>
+	/// <param name="start">position of first char in RadioText</param>
+	/// <param name="length">number of chars</param>
+	void addRadioTextPlusTag(const uint8_t& contentType, const uint8_t& start, const uint8_t& length);
+#if RDS_ENHANCED_RADIOTEXT
+	/// <summary>
+	/// Built-in (ODA) Open Data Application handler which decodes (eRT) Enhanced RadioText.
+	/// </summary>
+	/// <param name="context">pointer to decoder</param>
+	/// <param name="applicationId">AID of eRT</param>
+	/// <param name="type">type of received group</param>
+	/// <param name="blocks">blocks A, B, C and D of received group</param>
+	static void decodeEnhancedRadioText(void* context, const uint16_t& applicationId, const groupType& type, const uint16_t* const blocks[4]);
+#endif
+#pragma endregion
+#pragma region group 3a
+	/// <summary>
+	/// Registers handler of (ODA) Open Data Application. Groups assigned to this application in group 3A will be passed to handler
+	/// instead of being decoded as standard groups. Registering handler for AID which already has one replaces it.
+	/// </summary>
+	/// <param name="applicationId">(AID) Application Identification code</param>
+	/// <param name="handler">function which decodes application data</param>
+	/// <param name="context">pointer passed to handler, ex: object which stores decoded data</param>
+	/// <returns>true if handler was registered, false if there is no free slot</returns>
+	bool registerOpenDataApplication(const uint16_t& applicationId, odaHandler handler, void* context);
+
+	/// <summary>
+	/// Removes handler of (ODA) Open Data Application with given AID.
+	/// </summary>
+	/// <param name="applicationId">(AID) Application Identification code</param>
+	void unregisterOpenDataApplication(const uint16_t& applicationId);
+
+	/// <summary>
+	/// Clears assignment of group types to (ODA) Open Data Applications, registered handlers are kept.
+	/// </summary>
+	void clearOpenDataApplications(void);
+
+	/// <summary>
+	/// Decodes assignment of group type to (ODA) Open Data Application from group 3A and passes the group to its handler.
+	/// </summary>
+	void setOpenDataApplication(void);
+
+	/// <summary>
+	/// Passes received group to handler of (ODA) Open Data Application.
+	/// </summary>
+	/// <param name="handlerIndex">index of handler</param>
+	/// <param name="type">type of received group</param>
+	void dispatchOpenDataApplication(const uint8_t& handlerIndex, const groupType& type) const;
+
+	/// <summary>
+	/// Updates handler indices of all group types assigned to (ODA) Open Data Application with given AID.
+	/// </summary>
+	/// <param name="applicationId">(AID) Application Identification code</param>
+	/// <param name="handlerIndex">index of handler + 1, 0 if application has no handler</param>
+	void setOpenDataApplicationHandlerIndex(const uint16_t& applicationId, const uint8_t& handlerIndex);
 #pragma endregion
 #pragma region group 4a
 	/// <summary>
@@ -465,12 +1141,110 @@ private:
 	/// </summary>
 	void setDate(void);
 #pragma endregion
+#pragma region group 8a
+	/// <summary>
+	/// Decodes (TMC) Traffic Message Channel user message from group 8A. Single-group messages are stored at once,
+	/// multi-group ones when all their groups were received in sequence.
+	/// </summary>
+	void setTrafficMessage(void);
+
+	/// <summary>
+	/// Appends 28 bits of free format data from subsequent group of multi-group message.
+	/// </summary>
+	void addTrafficMessageFreeFormat(void);
+
+	/// <summary>
+	/// Returns DP code from duration label of free format data, or 0 if there is no such label.
+	/// </summary>
+	/// <param name="message">multi-group message</param>
+	/// <returns>DP code</returns>
+	static uint8_t getTrafficMessageFreeFormatDuration(const trafficMessage& message);
+
+	/// <summary>
+	/// Returns value of bits from free format data.
+	/// </summary>
+	/// <param name="message">multi-group message</param>
+	/// <param name="position">position of first bit</param>
+	/// <param name="length">number of bits, max 16</param>
+	/// <returns>bits value</returns>
+	static uint16_t getTrafficMessageFreeFormatBits(const trafficMessage& message, const uint8_t& position, const uint8_t& length);
+
+	/// <summary>
+	/// Puts message in store. Message with the same event and location is replaced, then expired one, then the one which expires first.
+	/// </summary>
+	/// <param name="message">message to store</param>
+	void storeTrafficMessage(trafficMessage& message);
+
+	/// <summary>
+	/// Removes all stored traffic messages.
+	/// </summary>
+	void clearTrafficMessages(void);
+#pragma endregion
 #pragma region group 10a
 	/// <summary>
 	/// Decodes (PTYN) Programme Type Name.
 	/// </summary>
 	void setProgrammeTypeName(void);
 #pragma endregion
+#if RDS_LONG_PS || RDS_ENHANCED_RADIOTEXT
+#pragma region segmented text
+	/// <summary>
+	/// Stores 4 bytes of text sent in segments. If segment which was already received has changed, station sends new text,
+	/// so previously received segments are removed.
+	/// </summary>
+	/// <param name="text">text buffer</param>
+	/// <param name="size">size of text buffer, multiple of 4</param>
+	/// <param name="receivedSegments">bitmap of received segments</param>
+	/// <param name="endPosition">position of end mark + 1, 0 if end mark wasn't received</param>
+	/// <param name="segment">segment address</param>
+	/// <param name="blockC">block with first two bytes</param>
+	/// <param name="blockD">block with last two bytes</param>
+	static void setSegmentedText(char* text, const uint8_t& size, uint32_t& receivedSegments, uint8_t& endPosition, const uint8_t& segment, const uint16_t& blockC, const uint16_t& blockD);
+
+	/// <summary>
+	/// Returns view of text sent in segments, if all segments before end mark were received.
+	/// </summary>
+	/// <param name="text">text buffer</param>
+	/// <param name="size">size of text buffer, multiple of 4</param>
+	/// <param name="receivedSegments">bitmap of received segments</param>
+	/// <param name="endPosition">position of end mark + 1, 0 if end mark wasn't received</param>
+	/// <returns>view of text without end mark and trailing zeros, empty if text is incomplete</returns>
+	static textView getSegmentedText(const char* text, const uint8_t& size, const uint32_t& receivedSegments, const uint8_t& endPosition);
+#pragma endregion
+#endif
+#pragma region group 14a and 14b
+	/// <summary>
+	/// Decodes (EON) Enhanced Other Networks information from group 14A or 14B and stores it in table entry of other network.
+	/// </summary>
+	void setOtherNetworkInformation(void);
+
+	/// <summary>
+	/// Returns index of table entry for other network with given PI. If it isn't stored, the oldest entry is replaced.
+	/// </summary>
+	/// <param name="programmeIdentification">PI code of other network</param>
+	/// <returns>index of entry</returns>
+	uint8_t getOtherNetworkEntry(const uint16_t& programmeIdentification);
+
+	/// <summary>
+	/// Adds frequency to AF list of other network. Frequencies already on the list and frequencies which don't fit in the list are skipped.
+	/// </summary>
+	/// <param name="entry">entry of other network</param>
+	/// <param name="code">AF code</param>
+	/// <param name="first">true if frequency has to be placed at the beginning of the list</param>
+	void addOtherNetworkFrequency(otherNetwork& entry, const uint8_t& code, const bool& first);
+
+	/// <summary>
+	/// Sets (TA) Traffic Announcement flag of other network and reports start of announcement.
+	/// </summary>
+	/// <param name="index">index of network entry</param>
+	/// <param name="trafficAnnouncement">received TA flag</param>
+	void setOtherNetworkTrafficAnnouncement(const uint8_t& index, const bool& trafficAnnouncement);
+
+	/// <summary>
+	/// Clears (EON) Enhanced Other Networks table.
+	/// </summary>
+	void clearOtherNetworks(void);
+#pragma endregion
 };
 
 #endif
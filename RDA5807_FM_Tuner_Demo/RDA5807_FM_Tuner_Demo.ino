@@ -7,9 +7,18 @@
 
 #include "RDA5807_FM_Tuner.h"
 #include "RDA5807_Utilities.h"
+#include "RDA5807_Scheduler.h"
+#include "RDA5807_RdsPoller.h"
 
 RDA5807* rda = nullptr;
 const RdsDecoder* rdsDecode = nullptr;
+RDA5807_RdsPoller* poller = nullptr;
+RDA5807_Scheduler scheduler;//every piece of work is a task, so I2C transactions are spread in time instead of being sent in one burst
+char utf8Text[(8 * 3) + 1];//every RDS char takes up to 3 bytes in UTF-8
+
+void pollRds(void* context);
+void checkWatchdog(void* context);
+void printStatus(void* context);
 
 // the setup function runs once when you press reset or power the board
 void setup() {
@@ -29,32 +38,56 @@ void setup() {
 	//rda->writeSettingsToReceiver();//when using alternative frequency setting method, use this method once to set all correctly, after that you can use writeModifiedSettings...
 	rda->updateVolumeLevel(0xFF);//set max volume
 	rda->updateReceivedFrequency(1009);//set received frequency to 100.9Mhz
+	poller = new RDA5807_RdsPoller(*rda);
+	rdsDecode = rda->getDecodedRdsData();//if you don't know if RDS was enabled, check returned pointer (it can be nullptr if RDS decoding was disabled)
+
+	scheduler.addTask(pollRds, poller, 1);//poller itself decides when receiver is checked, usually once per RDS group
+	scheduler.addTask(checkWatchdog, rda, 1000, 20);//offsets keep tasks away from each other
+	scheduler.addTask(printStatus, rda, 2000, 30);
 	Serial.println("...RDA5807 FM Tuner Demo started...");
 }
 
 // the loop function runs over and over again until power down or reset
 void loop() {
-	if (!(millis() % 2000))//do this every two seconds
-	{
-		Serial.println("----------");
-		//print stats about received station
-		Serial.print("Volume: "); Serial.print(RDA5807_Utilities::getVolumePercentage(rda->getVolume())); Serial.println("%");
-		Serial.print("Freq: "); Serial.print(RDA5807_Utilities::getFrequencyValue(rda->getChannel())); Serial.println("MHz");
-		rda->updateRssi();
-		Serial.print("RSSI: "); Serial.print(RDA5807_Utilities::getRssiDb(rda->getRssi())); Serial.println("dB");
-		if (rda->getRds())//if RDS is enabled then display received informations
-		{//RDA5807 seems to check for errors and correcting only RDS blocks A and B, so we never know if blocks C and D were received correctly
-			if (rda->checkIfNewRdsDataIsReady())
-			{
-				rda->updateRdsData();
-				rda->updateDecodedRdsData();//here you can check what RDS group was received to display or update only received informations
-				rdsDecode = rda->getDecodedRdsData();//if you don't know if RDS was enabled, check returned pointer (it can be nullptr if RDS decoding was disabled)
-			}
-			Serial.print("Time: "); Serial.print(rdsDecode->getHour()); Serial.print(":"); Serial.println(rdsDecode->getMinute());//to display local time instead of UTC, one need to add time offset
-			Serial.print("Station name: "); Serial.println(rdsDecode->getProgrammeServiceName());
-			Serial.print("Station type: "); Serial.println(rdsDecode->getProgrammeTypeName());
-			Serial.print("Radio text: "); Serial.println(rdsDecode->getRadioText());
-		}
-		Serial.println("----------");
+	scheduler.update();//runs at most one task, so loop stays responsive
+}
+
+void pollRds(void* context)
+{
+	if (!rda->getRds()) return;
+	static_cast<RDA5807_RdsPoller*>(context)->update();//when it returns true, here you can check what RDS group was received to display or update only received informations
+}
+
+void checkWatchdog(void* context)
+{
+	static_cast<RDA5807*>(context)->updateWatchdog();//restore settings if receiver lost them, for example after brown-out
+}
+
+void printStatus(void* context)
+{
+	RDA5807* receiver = static_cast<RDA5807*>(context);
+
+	Serial.println("----------");
+	//print stats about received station
+	Serial.print("Volume: "); Serial.print(RDA5807_Utilities::getVolumePercentage(receiver->getVolume())); Serial.println("%");
+	Serial.print("Freq: "); Serial.print(RDA5807_Utilities::getFrequencyValue(receiver->getChannel())); Serial.println("MHz");
+	receiver->updateRssi();
+	Serial.print("RSSI: "); Serial.print(RDA5807_Utilities::getRssiDb(receiver->getRssi())); Serial.println("dB");
+	if (receiver->getRds() && rdsDecode != nullptr)//if RDS is enabled then display received informations
+	{//RDA5807 seems to check for errors and correcting only RDS blocks A and B, so we never know if blocks C and D were received correctly
+		Serial.print("Time: "); Serial.print(rdsDecode->getHour()); Serial.print(":"); Serial.println(rdsDecode->getMinute());//to display local time instead of UTC, one need to add time offset
+		RDA5807_Utilities::convertRdsTextToUtf8(rdsDecode->getProgrammeServiceName(), 8, utf8Text, sizeof(utf8Text));//RDS uses its own character set
+		Serial.print("Station name: "); Serial.println(utf8Text);
+		Serial.print("Station type: "); Serial.println(rdsDecode->getProgrammeTypeName());
+		RDA5807_Utilities::getProgrammeTypeLabel(rdsDecode->getProgrammeTypeCode(), rdsDecode->getRbdsMode(), utf8Text);//use rda->setRbdsMode() in north America
+		Serial.print("Programme type: "); Serial.println(utf8Text);
+		Serial.print("Radio text: "); Serial.println(rdsDecode->getRadioText());
+		RdsDecoder::textView tag = rdsDecode->getRadioTextPlusTag(RdsDecoder::radioTextPlusContentType::itemArtist);//RadioText Plus tags point to parts of radio text
+		if (tag.length) { Serial.print("Artist: "); Serial.write(tag.data, tag.length); Serial.println(); }
+		tag = rdsDecode->getRadioTextPlusTag(RdsDecoder::radioTextPlusContentType::itemTitle);
+		if (tag.length) { Serial.print("Title: "); Serial.write(tag.data, tag.length); Serial.println(); }
 	}
+	Serial.print("RDS polls per group: "); Serial.print(poller->getPollsPerGroup()); Serial.print(", lost groups: "); Serial.print(poller->getGroupLossRate()); Serial.println("%");
+	Serial.print("Longest loop delay: "); Serial.print(scheduler.getMaxUpdateTime()); Serial.println("us");
+	Serial.println("----------");
 }